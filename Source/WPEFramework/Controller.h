@@ -234,6 +234,7 @@ namespace Plugin {
 
             data.PendingRequests = snapshot.Pending;
             data.PoolOccupation = snapshot.Occupation;
+            data.ActiveThreads = snapshot.Active;
 
             for (uint8_t teller = 0; teller < snapshot.Slots; teller++) {
                 // Example of why copy-constructor and assignment constructor should be equal...
@@ -259,7 +260,7 @@ namespace Plugin {
         uint32_t endpoint_storeconfig();
         uint32_t endpoint_delete(const JsonData::Controller::DeleteParamsData& params);
         uint32_t endpoint_harakiri();
-        uint32_t get_status(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Service>& response) const;
+        uint32_t get_status(const string& index, Core::JSON::GeneratorType<PluginHost::MetaData::Service>& response) const;
         uint32_t get_links(Core::JSON::ArrayType<PluginHost::MetaData::Channel>& response) const;
         uint32_t get_processinfo(PluginHost::MetaData::Server& response) const;
         uint32_t get_subsystems(Core::JSON::ArrayType<JsonData::Controller::SubsystemsParamsData>& response) const;
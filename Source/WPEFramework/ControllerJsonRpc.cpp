@@ -21,7 +21,7 @@ namespace Plugin {
         Register<void,void>(_T("storeconfig"), &Controller::endpoint_storeconfig, this);
         Register<DeleteParamsData,void>(_T("delete"), &Controller::endpoint_delete, this);
         Register<void,void>(_T("harakiri"), &Controller::endpoint_harakiri, this);
-        Property<Core::JSON::ArrayType<PluginHost::MetaData::Service>>(_T("status"), &Controller::get_status, nullptr, this);
+        Property<Core::JSON::GeneratorType<PluginHost::MetaData::Service>>(_T("status"), &Controller::get_status, nullptr, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Channel>>(_T("links"), &Controller::get_links, nullptr, this);
         Property<PluginHost::MetaData::Server>(_T("processinfo"), &Controller::get_processinfo, nullptr, this);
         Property<Core::JSON::ArrayType<SubsystemsParamsData>>(_T("subsystems"), &Controller::get_subsystems, nullptr, this);
@@ -204,7 +204,7 @@ namespace Plugin {
     // Return codes:
     //  - ERROR_NONE: Success
     //  - ERROR_UNKNOWN_KEY: The service does not exist
-    uint32_t Controller::get_status(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Service>& response) const
+    uint32_t Controller::get_status(const string& index, Core::JSON::GeneratorType<PluginHost::MetaData::Service>& response) const
     {
         uint32_t result = Core::ERROR_UNKNOWN_KEY;
         Core::ProxyType<PluginHost::Server::Service> service;
@@ -219,10 +219,12 @@ namespace Plugin {
             if (_pluginServer->Services().FromIdentifier(index, service) == Core::ERROR_NONE) {
                 ASSERT(service.IsValid());
 
-                PluginHost::MetaData::Service status;
-                service->GetMetaData(status);
-
-                response.Add(status);
+                response = [service](const uint32_t index, PluginHost::MetaData::Service& status) -> bool {
+                    if (index == 0) {
+                        service->GetMetaData(status);
+                    }
+                    return (index == 0);
+                };
 
                 result = Core::ERROR_NONE;
             }
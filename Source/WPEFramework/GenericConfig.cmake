@@ -12,10 +12,15 @@ set(WEBSERVER_PORT 8080 CACHE STRING "Port for the HTTP server")
 set(PROXYSTUB_PATH "${CMAKE_INSTALL_PREFIX}/lib/${NAMESPACE_LIB}/proxystubs" CACHE STRING "Proxy stub path")
 set(CONFIG_INSTALL_PATH "/etc/${NAMESPACE}" CACHE STRING "Install location of the configuration")
 set(IPV6_SUPPORT false CACHE STRING "Controls if should application supports ipv6")
+set(ZYGOTE false CACHE STRING "Fork out-of-process plugin hosts from a pre-started host")
+set(SHARED_THRESHOLD 0 CACHE STRING "Pass COM-RPC buffers of at least this size through shared memory, 0 to disable")
 set(PRIORITY 0 CACHE STRING "Change the nice level [-20 - 20]")
 set(POLICY "OTHER" CACHE STRING "NA")
 set(OOMADJUST 0 CACHE STRING "Adapt the OOM score [-15 - 15]")
 set(STACKSIZE 0 CACHE STRING "Default stack size per thread")
+set(THREADPOOL_MINIMUM 0 CACHE STRING "Minimum number of threads in the thread pool, 0 for a fixed size pool of THREADPOOL_COUNT threads")
+set(THREADPOOL_IDLETIME 30 CACHE STRING "Seconds an additional thread of the thread pool may idle before it retires")
+set(THREADPOOL_WORKSTEALING false CACHE STRING "Use per thread queues and work stealing in the thread pool")
 
 map()
   key(plugins)
@@ -28,6 +33,8 @@ ans(CONFIG)
 map_set(${CONFIG} port ${PORT})
 map_set(${CONFIG} binding ${BINDING})
 map_set(${CONFIG} ipv6 ${IPV6_SUPPORT})
+map_set(${CONFIG} zygote ${ZYGOTE})
+map_set(${CONFIG} sharedthreshold ${SHARED_THRESHOLD})
 map_set(${CONFIG} idletime ${IDLE_TIME})
 map_set(${CONFIG} persistentpath ${PERSISTENT_PATH})
 map_set(${CONFIG} volatilepath ${VOLATILE_PATH})
@@ -45,6 +52,15 @@ end()
 ans(PROCESS_CONFIG)
 map_append(${CONFIG} process ${PROCESS_CONFIG})
 
+map()
+    kv(threads ${THREADPOOL_COUNT})
+    kv(minimum ${THREADPOOL_MINIMUM})
+    kv(idletime ${THREADPOOL_IDLETIME})
+    kv(workstealing ${THREADPOOL_WORKSTEALING})
+end()
+ans(WORKERPOOL_CONFIG)
+map_append(${CONFIG} workerpool ${WORKERPOOL_CONFIG})
+
 map()
     kv(callsign Controller)
     key(configuration)
@@ -145,6 +145,8 @@ namespace PluginHost {
         if ((signo == SIGTERM) || (signo == SIGQUIT)) {
             ExitHandler::Construct();
         } else if (signo == SIGSEGV) {
+            // Staged trace lines are the most valuable right now, get them into the trace buffer.
+            Trace::TraceUnit::Instance().Salvage();
             DumpCallStack();
             // now invoke the default segfault handler
             signal(signo, SIG_DFL);
@@ -620,6 +622,11 @@ namespace PluginHost {
                     for (uint8_t index = 0; index < metaData.Slots; index++) {
                         printf("  Thread%02d:  %d\n", (index + 1), metaData.Slot[index]);
                     }
+                    const RPC::Administrator::Metadata rpc(RPC::Administrator::Instance().Snapshot());
+                    printf("COM-RPC allocations:\n");
+                    printf("  Messages:  %d\n", rpc.Messages);
+                    printf("  Jobs:      %d\n", rpc.Jobs);
+                    printf("  Frames:    %d\n", rpc.Frames);
                     status->Release();
                     break;
                 }
@@ -678,9 +685,12 @@ namespace PluginHost {
 
 #if !defined(__WINDOWS__) && !defined(__APPLE__)
                 case 'R': {
-                    printf("\nMonitor callstack:\n");
-                    printf("============================================================\n");
-                    PublishCallstack(Core::ResourceMonitor::Instance().Id());
+                    Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+                    for (uint8_t index = 0; index < monitor.Shards(); index++) {
+                        printf("\nMonitor[%d] callstack:\n", index);
+                        printf("============================================================\n");
+                        PublishCallstack(monitor.Id(index));
+                    }
                     break;
                 }
                 case '0':
@@ -692,13 +702,13 @@ namespace PluginHost {
                 case '6':
                 case '7':
                 case '8': {
-                    uint32_t threadId = _dispatcher->WorkerPool().ThreadId(keyPress - '0');
-                    printf("\nThreadPool thread[%c,%d] callstack:\n", keyPress, threadId);
+                    ::ThreadId threadId = _dispatcher->WorkerPool().ThreadId(keyPress - '0');
+                    printf("\nThreadPool thread[%c] callstack:\n", keyPress);
                     printf("============================================================\n");
-                    if (threadId != static_cast<uint32_t>(~0)) {
+                    if (threadId != 0) {
                         PublishCallstack(threadId);
                     } else {
-                       printf("The given Thread ID is not in a valid range, please give thread id between 0 and %d\n", THREADPOOL_COUNT);
+                       printf("The given Thread ID is not in a valid range, please give thread id between 1 and %d\n", _dispatcher->WorkerPool().Snapshot().Active - 1);
                     }
 
                     break;
@@ -713,7 +723,7 @@ namespace PluginHost {
                     printf("  [T]rigger resource monitor\n");
                     printf("  [M]etadata resource monitor\n");
                     printf("  [R]esource monitor stack\n");
-                    printf("  [0..%d] Workerpool stacks\n", THREADPOOL_COUNT);
+                    printf("  [1..%d] Workerpool stacks\n", _dispatcher->WorkerPool().Snapshot().Active - 1);
                     printf("  [Q]uit\n\n");
                     break;
 
@@ -365,6 +365,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 }
             } else {
 
+                const uint64_t start(Core::Time::Now().Ticks());
+
                 State(ACTIVATION);
                 _administrator.StateChange(this);
 
@@ -398,7 +400,11 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                         dispatcher->Release();
                     }
 
-                    SYSLOG(Logging::Startup, (_T("Activated plugin [%s]:[%s]"), className.c_str(), callSign.c_str()));
+                    const uint32_t activation = static_cast<uint32_t>((Core::Time::Now().Ticks() - start) / Core::Time::TicksPerMillisecond);
+
+                    _activation = activation;
+
+                    SYSLOG(Logging::Startup, (_T("Activated plugin [%s]:[%s] in %d ms"), className.c_str(), callSign.c_str(), activation));
                     Lock();
                     State(ACTIVATED);
                     _administrator.StateChange(this);
@@ -605,7 +611,7 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
 
     Server::Server(Server::Config & configuration, const bool background)
         : _accessor()
-        , _dispatcher(configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
+        , _dispatcher(configuration.WorkerPool, configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
         , _connections(*this, DetermineAccessor(configuration, _accessor), configuration.IdleTime)
         , _config(configuration.Version.Value(),
               DetermineProperModel(configuration.Model),
@@ -636,6 +642,17 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
             _environment.Set(_config, configuration.Environments);
         }
 
+        if (configuration.SharedThreshold.Value() != 0) {
+            RPC::Administrator::Instance().Threshold(configuration.SharedThreshold.Value());
+
+            // The hosts we start pick it up from their environment.
+            Core::SystemInfo::SetEnvironment(_T("COM_SHARED_THRESHOLD"), Core::NumberType<uint32_t>(configuration.SharedThreshold.Value()).Text());
+        }
+
+        if ((configuration.Zygote.Value() == true) && (_services.Preload() != Core::ERROR_NONE)) {
+            SYSLOG(Logging::Startup, (_T("Zygote could not be started, out-of-process plugins are started from scratch.")));
+        }
+
         Core::JSON::ArrayType<Plugin::Config>::Iterator index = configuration.Plugins.Elements();
 
         // First register all services, than if we got them, start "activating what is required.
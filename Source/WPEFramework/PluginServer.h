@@ -186,6 +186,52 @@ namespace PluginHost {
                 Core::JSON::EnumType<PluginHost::InputHandler::type> Type;
             };
 
+            class WorkerPoolConfig : public Core::JSON::Container {
+            public:
+                WorkerPoolConfig()
+                    : Threads(THREADPOOL_COUNT)
+                    , Minimum(0)
+                    , IdleTime(30)
+                    , WorkStealing(false)
+                {
+                    Add(_T("threads"), &Threads);
+                    Add(_T("minimum"), &Minimum);
+                    Add(_T("idletime"), &IdleTime);
+                    Add(_T("workstealing"), &WorkStealing);
+                }
+                WorkerPoolConfig(const WorkerPoolConfig& copy)
+                    : Threads(copy.Threads)
+                    , Minimum(copy.Minimum)
+                    , IdleTime(copy.IdleTime)
+                    , WorkStealing(copy.WorkStealing)
+                {
+                    Add(_T("threads"), &Threads);
+                    Add(_T("minimum"), &Minimum);
+                    Add(_T("idletime"), &IdleTime);
+                    Add(_T("workstealing"), &WorkStealing);
+                }
+                ~WorkerPoolConfig()
+                {
+                }
+                WorkerPoolConfig& operator=(const WorkerPoolConfig& RHS)
+                {
+                    Threads = RHS.Threads;
+                    Minimum = RHS.Minimum;
+                    IdleTime = RHS.IdleTime;
+                    WorkStealing = RHS.WorkStealing;
+                    return (*this);
+                }
+
+                // Maximum number of threads in the pool, THREADPOOL_COUNT if not set.
+                Core::JSON::DecUInt8 Threads;
+                // Number of threads the pool starts with and shrinks back to. If not set (or
+                // equal to Threads) the pool has a fixed size, otherwise it is elastic.
+                Core::JSON::DecUInt8 Minimum;
+                // Time (in seconds) an additional thread may be idle before it retires.
+                Core::JSON::DecUInt16 IdleTime;
+                Core::JSON::Boolean WorkStealing;
+            };
+
 #ifdef PROCESSCONTAINERS_ENABLED
 
             class ProcessContainerConfig : public Core::JSON::Container {
@@ -242,8 +288,11 @@ namespace PluginHost {
                 , Signature(_T("TestSecretKey"))
                 , IdleTime(0)
                 , IPV6(false)
+                , Zygote(false)
+                , SharedThreshold(0)
                 , DefaultTraceCategories(false)
                 , Process()
+                , WorkerPool()
                 , Input()
                 , Configs()
                 , Environments()
@@ -267,9 +316,12 @@ namespace PluginHost {
                 Add(_T("signature"), &Signature);
                 Add(_T("idletime"), &IdleTime);
                 Add(_T("ipv6"), &IPV6);
+                Add(_T("zygote"), &Zygote);
+                Add(_T("sharedthreshold"), &SharedThreshold);
                 Add(_T("tracing"), &DefaultTraceCategories);
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
+                Add(_T("workerpool"), &WorkerPool);
                 Add(_T("input"), &Input);
                 Add(_T("plugins"), &Plugins);
                 Add(_T("configs"), &Configs);
@@ -300,8 +352,13 @@ namespace PluginHost {
             Core::JSON::String Signature;
             Core::JSON::DecUInt16 IdleTime;
             Core::JSON::Boolean IPV6;
+            // Fork out-of-process plugin hosts from a pre-started host (Linux only).
+            Core::JSON::Boolean Zygote;
+            // COM-RPC buffers of at least this size travel through shared memory, 0 keeps them in the message.
+            Core::JSON::DecUInt32 SharedThreshold;
             Core::JSON::String DefaultTraceCategories;
             ProcessSet Process;
+            WorkerPoolConfig WorkerPool;
             InputConfig Input;
             Core::JSON::String Configs;
             Core::JSON::ArrayType<Plugin::Config> Plugins;
@@ -311,19 +368,97 @@ namespace PluginHost {
 #endif
         };
 
-        class WorkerPoolImplementation : public Core::WorkerPoolType<THREADPOOL_COUNT> {
+        class WorkerPoolImplementation : public Core::WorkerPool {
         public:
             WorkerPoolImplementation() = delete;
             WorkerPoolImplementation(const WorkerPoolImplementation&) = delete;
             WorkerPoolImplementation& operator=(const WorkerPoolImplementation&) = delete;
 
-            WorkerPoolImplementation(const uint32_t stackSize)
-                : Core::WorkerPoolType<THREADPOOL_COUNT>(stackSize)
+            WorkerPoolImplementation(const Config::WorkerPoolConfig& config, const uint32_t stackSize)
+                : Core::WorkerPool(
+                      Threads(config),
+                      new uint32_t[Threads(config)],
+                      config.WorkStealing.Value(),
+                      config.Minimum.Value(),
+                      IdleTime(config))
+                , _stackSize(stackSize)
+                , _minionLock()
+                , _minions()
             {
             }
             virtual ~WorkerPoolImplementation()
             {
+                Stop();
+                _minions.clear();
+                delete[] Snapshot().Slot;
+            }
+
+        public:
+            inline ::ThreadId ThreadId(const uint8_t index) const
+            {
+                ::ThreadId result = 0;
+
+                if (index > 0) {
+                    Core::SafeSyncType<Core::CriticalSection> scopedLock(_minionLock);
+
+                    std::list<Core::WorkerPool::Minion>::const_iterator element(_minions.begin());
+                    uint8_t count = index;
+
+                    while ((element != _minions.end()) && (count > 1)) {
+                        count--;
+                        element++;
+                    }
+
+                    if (element != _minions.end()) {
+                        result = element->Id();
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            // A pool needs at least one slot, the thread that joins it. No (or a zero) size falls back to the default.
+            static uint8_t Threads(const Config::WorkerPoolConfig& config)
+            {
+                return ((config.Threads.Value() == 0) ? THREADPOOL_COUNT : config.Threads.Value());
+            }
+            // Additional threads should at least idle for a second before they retire.
+            static uint32_t IdleTime(const Config::WorkerPoolConfig& config)
+            {
+                return ((config.IdleTime.Value() == 0) ? 1000 : (config.IdleTime.Value() * 1000));
+            }
+            virtual Core::WorkerPool::Minion& Index(const uint8_t index) override
+            {
+                Core::SafeSyncType<Core::CriticalSection> scopedLock(_minionLock);
+
+                // Minions, and thus their stacks, are only created once the slot is used for the first time.
+                // The list never moves its elements, so the reference stays valid after the lock is released.
+                while (_minions.size() < index) {
+                    _minions.emplace_back(_stackSize);
+                }
+
+                uint8_t count = index;
+                std::list<Core::WorkerPool::Minion>::iterator element(_minions.begin());
+
+                while ((element != _minions.end()) && (count > 1)) {
+                    count--;
+                    element++;
+                }
+
+                ASSERT(element != _minions.end());
+
+                return (*element);
+            }
+            virtual bool Running() override
+            {
+                return (true);
             }
+
+        private:
+            const uint32_t _stackSize;
+            mutable Core::CriticalSection _minionLock;
+            std::list<Core::WorkerPool::Minion> _minions;
         };
 
     private:
@@ -587,6 +722,7 @@ namespace PluginHost {
                 , _precondition(plugin->Precondition, true)
                 , _termination(plugin->Termination, false)
                 , _activity(0)
+                , _activation(~0)
                 , _administrator(*administrator)
             {
                 ASSERT(server != nullptr);
@@ -892,6 +1028,10 @@ namespace PluginHost {
                     metaData.Module = _moduleName;
                 if (_versionHash.empty() == false)
                     metaData.Hash = _versionHash;
+                const uint32_t activation = _activation;
+
+                if (activation != static_cast<uint32_t>(~0))
+                    metaData.Activation = activation;
 
                 PluginHost::Service::GetMetaData(metaData);
             }
@@ -1096,6 +1236,8 @@ namespace PluginHost {
             Condition _precondition;
             Condition _termination;
             uint32_t _activity;
+            // Time (in ms) the last successful activation took.
+            std::atomic<uint32_t> _activation;
 
             ServiceMap& _administrator;
             static Core::ProxyType<Web::Response> _unavailableHandler;
@@ -1233,6 +1375,10 @@ namespace PluginHost {
 
                     return (RPC::Communicator::Create(connectionId, instance, RPC::Config(RPC::Communicator::Connector(), _application, persistentPath, _systemPath, dataPath, volatilePath, _appPath, _proxyStubPath), waitTime));
                 }
+                uint32_t Preload()
+                {
+                    return (RPC::Communicator::Preload(_application, _proxyStubPath));
+                }
                 const string& PersistentPath() const
                 {
                     return (_persistentPath);
@@ -1766,6 +1912,10 @@ namespace PluginHost {
                 {
                     return (_processAdministrator.Create(sessionId, object, className, callsign, waitTime));
                 }
+                inline uint32_t Preload()
+                {
+                    return (_processAdministrator.Preload());
+                }
                 virtual void Register(RPC::IRemoteConnection::INotification* sink) override
                 {
                     _processAdministrator.Register(sink);
@@ -1859,6 +2009,31 @@ namespace PluginHost {
                         duplicates.pop_front();
                     }
                 }
+                void GetMetaData(Core::JSON::GeneratorType<MetaData::Service>& metaData) const
+                {
+                    std::vector<Core::ProxyType<Service>> duplicates;
+
+                    _adminLock.Lock();
+
+                    duplicates.reserve(_services.size());
+
+                    std::map<const string, Core::ProxyType<Service>>::const_iterator index(_services.begin());
+
+                    while (index != _services.end()) {
+                        duplicates.push_back(index->second);
+                        index++;
+                    }
+
+                    _adminLock.Unlock();
+
+                    // The metadata of a service is only gathered when it is sent.
+                    metaData = [duplicates](const uint32_t index, MetaData::Service& element) -> bool {
+                        if (index < duplicates.size()) {
+                            duplicates[index]->GetMetaData(element);
+                        }
+                        return (index < duplicates.size());
+                    };
+                }
                 uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service)
                 {
                     uint32_t result = Core::ERROR_UNAVAILABLE;
@@ -2462,7 +2637,23 @@ namespace PluginHost {
 
                     if (_service.IsValid() == true) {
                         if (State() == JSONRPC) {
-                            result = Core::ProxyType<Core::JSON::IElement>(Factories::Instance().JSONRPC());
+                            Core::ProxyType<Core::JSONRPC::Message> message(Factories::Instance().JSONRPC());
+                            Core::ProxyType<Service> service(_service);
+
+                            // Let the dispatcher hand out the typed parameters of the method that is called, so
+                            // they can be deserialized from the frame directly. The dispatcher is looked up when
+                            // the method is known, the plugin might have been deactivated by then.
+                            message->Resolve([service](const string& designator) -> Core::ProxyType<Core::JSON::IElement> {
+                                Core::ProxyType<Core::JSON::IElement> element;
+                                PluginHost::IDispatcher* dispatcher = service->Dispatcher();
+
+                                if (dispatcher != nullptr) {
+                                    element = dispatcher->Parameters(designator);
+                                }
+
+                                return (element);
+                            });
+                            result = Core::ProxyType<Core::JSON::IElement>(message);
                         } else {
                             result = _service->Inbound(identifier);
                         }
@@ -2485,6 +2676,9 @@ namespace PluginHost {
                     if (State() & Channel::JSONRPC) {
                         Core::ProxyType<Core::JSONRPC::Message> message(Core::proxy_cast<Core::JSONRPC::Message>(element));
                         if (message.IsValid()) {
+                            // Deserialization is done, the resolver (and the service it holds) is no longer needed.
+                            message->Resolve(nullptr);
+
                             PluginHost::Channel::Lock();
                             securityClearance = _security->Allowed(*message);
                             PluginHost::Channel::Unlock();
@@ -2590,6 +2784,8 @@ namespace PluginHost {
                                 State(TEXT, false);
                             } else if (Protocol() == _T("jsonrpc")) {
                                 State(JSONRPC, false);
+                            } else if (Protocol() == _T("jsonrpc-msgpack")) {
+                                State(JSONRPC, false, true);
                             } else {
                                 // Channel is a raw communication channel.
                                 // This channel allows for passing binary data back and forth
@@ -2610,7 +2806,7 @@ namespace PluginHost {
                             if (Name().length() > (JSONRPCHeader.length() + 1)) {
                                 Properties(static_cast<uint32_t>(JSONRPCHeader.length()) + 1);
                             }
-                            State(JSONRPC, false);
+                            State(JSONRPC, false, (Protocol() == _T("jsonrpc-msgpack")));
 
                             // The state needs to be correct before we c
                             if (_service->Subscribe(*this) == false) {
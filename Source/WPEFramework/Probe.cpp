@@ -107,6 +107,8 @@ namespace Plugin {
         , _model(model)
         , _destinations()
     {
+        // Discovery requests tend to come in bursts, pick them up in batches.
+        Link().Batch(8);
 
         if (Link().Open(1000) != Core::ERROR_NONE) {
             ASSERT(false && "Seems we can not open the discovery port");
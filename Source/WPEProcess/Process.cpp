@@ -161,7 +161,7 @@ namespace Process {
     class ConsoleOptions : public Core::Options {
     public:
         ConsoleOptions(int argumentCount, TCHAR* arguments[])
-            : Core::Options(argumentCount, arguments, _T("h:l:c:r:p:s:d:a:m:i:u:g:t:e:x:V:v:"))
+            : Core::Options(argumentCount, arguments, _T("h:l:c:r:p:s:d:a:m:i:u:g:t:e:x:V:v:Z:"))
             , Locator(nullptr)
             , ClassName(nullptr)
             , RemoteChannel(nullptr)
@@ -178,6 +178,7 @@ namespace Process {
             , Group(nullptr)
             , Threads(1)
             , EnabledLoggings(0)
+            , Zygote(-1)
         {
             Parse();
         }
@@ -202,6 +203,7 @@ namespace Process {
         const TCHAR* Group;
         uint8_t Threads;
         uint32_t EnabledLoggings;
+        int Zygote;
 
     private:
         string Strip(const TCHAR text[]) const {
@@ -267,6 +269,9 @@ namespace Process {
             case 't':
                 Threads = Core::NumberType<uint8_t>(Core::TextFragment(argument)).Value();
                 break;
+            case 'Z':
+                Zygote = Core::NumberType<int32_t>(Core::TextFragment(argument)).Value();
+                break;
             case 'h':
             default:
                 RequestUsage(true);
@@ -325,6 +330,29 @@ namespace Process {
         return (result);
     }
 
+#ifdef __LINUX__
+    static std::vector<string> _arguments;
+    static std::vector<char*> _argumentList;
+
+    // Serve as zygote. Returns only in the processes forked on request, with the arguments they were requested with.
+    static bool Fork(const int channel, const string& proxyStubPath, int& argc, char**& argv)
+    {
+        bool forked = RPC::Zygote::Serve(channel, proxyStubPath, _arguments);
+
+        if (forked == true) {
+            for (string& argument : _arguments) {
+                _argumentList.push_back(&argument[0]);
+            }
+            _argumentList.push_back(nullptr);
+
+            argc = static_cast<int>(_arguments.size());
+            argv = _argumentList.data();
+        }
+
+        return (forked);
+    }
+#endif
+
 }
 } // Process
 
@@ -339,6 +367,8 @@ void ExitDaemonHandler(int signo)
     if ((signo == SIGTERM) || (signo == SIGQUIT)) {
         ExitHandler::Construct();
     } else if (signo == SIGSEGV) {
+        // Staged trace lines are the most valuable right now, get them into the trace buffer.
+        Trace::TraceUnit::Instance().Salvage();
         DumpCallStack();
         // now invoke the default segfault handler
         signal(signo, SIG_DFL);
@@ -356,6 +386,20 @@ int main(int argc, char** argv)
     // Give the debugger time to attach to this process..
     // Sleep(20000);
 
+#ifdef __LINUX__
+    {
+        Process::ConsoleOptions zygote(argc, argv);
+
+        if ((zygote.Zygote != -1) && (Process::Fork(zygote.Zygote, zygote.ProxyStubPath, argc, argv) == false)) {
+            Core::Singleton::Dispose();
+            return (0);
+        }
+
+        // Parse the options of this process from scratch.
+        optind = 0;
+    }
+#endif
+
     if (atexit(ExitHandler::Destruct) != 0) {
         TRACE_L1("Could not register @exit handler. Argc %d.", argc);
         ExitHandler::Destruct();
@@ -397,13 +441,16 @@ int main(int argc, char** argv)
         printf("        [-v <volatile path>]\n");
         printf("        [-a <app path>]\n");
         printf("        [-m <proxy stub library path>]\n");
-        printf("        [-e <enabled SYSLOG categories>]\n\n");
+        printf("        [-e <enabled SYSLOG categories>]\n");
+        printf("        [-Z <zygote channel>]\n\n");
         printf("This application spawns a seperate process space for a plugin. The plugins");
         printf("are searched in the same order as they are done in process. Starting from:\n");
         printf(" 1) <persistent path>/<locator>\n");
         printf(" 2) <system path>/<locator>\n");
         printf(" 3) <data path>/<locator>\n");
         printf(" 4) <app path>/Plugins/<locator>\n\n");
+        printf("Started with a zygote channel, the process preloads the proxy stubs and forks a new process, ");
+        printf("with the arguments received over the channel, for every request.\n\n");
         printf("Within the DSO, the system looks for an object with <classname>, this object must implement ");
         printf("the interface, indicated byt the Id <interfaceId>, and if passed, the object should be of ");
         printf("version <version>. All these conditions must met for an object to be instantiated and thus run.\n\n");
@@ -10,7 +10,15 @@ namespace RPC {
         , _proxy()
         , _factory(8)
         , _channelProxyMap()
+        , _channelReferenceMap()
+        , _channelArenaMap()
+        , _threshold(0)
     {
+        string value;
+
+        if (Core::SystemInfo::GetEnvironment(_T("COM_SHARED_THRESHOLD"), value) == true) {
+            _threshold = Core::NumberType<uint32_t>(value.c_str(), static_cast<uint32_t>(value.length())).Value();
+        }
     }
 
     /* virtual */ Administrator::~Administrator()
@@ -24,13 +32,23 @@ namespace RPC {
         return (systemAdministrator);
     }
 
+    Administrator::Metadata Administrator::Snapshot() const
+    {
+        Metadata result;
+
+        result.Messages = _factory.CreatedElements();
+        result.Jobs = Job::Created();
+        result.Frames = Data::Frame::Allocations();
+
+        return (result);
+    }
+
     void Administrator::AddRef(void* impl, const uint32_t interfaceId)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub;
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (_stubs.Find(interfaceId, stub) == true) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
@@ -45,11 +63,10 @@ namespace RPC {
 
     void Administrator::Release(void* impl, const uint32_t interfaceId)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub;
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (_stubs.Find(interfaceId, stub) == true) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
@@ -78,12 +95,17 @@ namespace RPC {
     {
         uint32_t interfaceId(message->Parameters().InterfaceId());
 
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub;
 
-        if (index != _stubs.end()) {
+        // Stubs are only added, looking them up takes no lock.
+        if (_stubs.Find(interfaceId, stub) == true) {
             uint32_t methodId(message->Parameters().MethodId());
-            index->second->Handle(methodId, channel, message);
+            Core::ProxyType<Data::Arena> arena(Arena(channel));
+
+            message->Parameters().Bind(arena);
+            message->Response().Bind(arena);
+
+            stub->Handle(methodId, channel, message);
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
             TRACE_L1("Unknown interface. %d", interfaceId);
@@ -96,19 +118,12 @@ namespace RPC {
 
         _adminLock.Lock();
 
-        ChannelMap::iterator index(_channelProxyMap.find(channel));
+        ProxyList& proxies(_channelProxyMap[channel]);
+        const ProxyKey key = { proxy.Implementation(), proxy.InterfaceId() };
 
-        if (index == _channelProxyMap.end()) {
-            auto slot = _channelProxyMap.emplace(std::piecewise_construct,
-                std::forward_as_tuple(channel),
-                std::forward_as_tuple());
-            slot.first->second.push_back(&proxy);
+        ASSERT(Find(proxies, key, &proxy) == proxies.end());
 
-        } else {
-            ASSERT(std::find(index->second.begin(), index->second.end(), &proxy) == index->second.end());
-
-            index->second.push_back(&proxy);
-        }
+        proxies.insert(std::pair<ProxyKey, ProxyStub::UnknownProxy*>(key, &proxy));
 
         Core::InterlockedIncrement(proxy._refCount);
 
@@ -121,10 +136,9 @@ namespace RPC {
         ChannelMap::iterator index(_channelProxyMap.find(proxy.Channel().operator->()));
 
         if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && ((*entry) != &proxy)) {
-                entry++;
-            }
+            const ProxyKey key = { proxy.Implementation(), proxy.InterfaceId() };
+            ProxyList::iterator entry(Find(index->second, key, &proxy));
+
             if (entry != index->second.end()) {
                 index->second.erase(entry);
                 Core::InterlockedDecrement(proxy._refCount);
@@ -149,12 +163,11 @@ namespace RPC {
         ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
 
         if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                entry++;
-            }
+            const ProxyKey key = { impl, id };
+            ProxyList::iterator entry(index->second.find(key));
+
             if (entry != index->second.end()) {
-                result = (*entry)->QueryInterface(interfaceId);
+                result = entry->second->QueryInterface(interfaceId);
             }
         }
 
@@ -174,15 +187,14 @@ namespace RPC {
             ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
 
             if (index != _channelProxyMap.end()) {
-                ProxyList::iterator entry(index->second.begin());
-                while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                    entry++;
-                }
+                const ProxyKey key = { impl, id };
+                ProxyList::iterator entry(index->second.find(key));
+
                 if (entry != index->second.end()) {
-                    result = (*entry);
+                    result = entry->second;
 
                     if (refCounted == true) {
-                       if( (*entry)->AddRefCachedCount() == false ) {
+                       if( result->AddRefCachedCount() == false ) {
                            result = nullptr; // we cannot use this proxy it is being destructed, we need to create a new one
                        }
                     } else if (piggyBack == true) {
@@ -204,7 +216,8 @@ namespace RPC {
 
                     if (refCounted == true) {
                         // Register it as it is remotely registered :-)
-                        _channelProxyMap[channel.operator->()].push_back(result);
+                        const ProxyKey key = { impl, id };
+                        _channelProxyMap[channel.operator->()].insert(std::pair<ProxyKey, ProxyStub::UnknownProxy*>(key, result));
                     } else if (piggyBack == true) {
                         // Reference counting can be cached on this on object for now. This is a request
                         // from an incoming interface of which the lifetime is guaranteed by the callee.
@@ -261,8 +274,33 @@ namespace RPC {
 
     Core::IUnknown* Administrator::Convert(void* rawImplementation, const uint32_t id) 
     {
-        std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index (_stubs.find(id));
-        return(index != _stubs.end() ? index->second->Convert(rawImplementation) : nullptr);
+        ProxyStub::UnknownStub* stub;
+        return(_stubs.Find(id, stub) == true ? stub->Convert(rawImplementation) : nullptr);
+    }
+
+    Core::ProxyType<Data::Arena> Administrator::Arena(const Core::ProxyType<Core::IPCChannel>& channel)
+    {
+        Core::ProxyType<Data::Arena> result;
+
+        if (_channelArenaMap.Find(channel.operator->(), result) == false) {
+
+            _adminLock.Lock();
+
+            if (_channelArenaMap.Find(channel.operator->(), result) == false) {
+                // Even without a threshold of our own, we need it to read what the other side shares.
+                result = Core::ProxyType<Data::Arena>::Create(_threshold, Data::ARENA_SIZE);
+                _channelArenaMap.Insert(channel.operator->(), result);
+            }
+
+            _adminLock.Unlock();
+        }
+
+        return (result);
+    }
+
+    void Administrator::ReleaseArena(const Core::ProxyType<Core::IPCChannel>& channel)
+    {
+        _channelArenaMap.Remove(channel.operator->());
     }
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies, std::list<ExposedInterface>& usedInterfaces)
@@ -278,8 +316,8 @@ namespace RPC {
                 // interface is released in the same time before we report this interface
                 // to be dead. So lets keep a refernce so we can work on a real object
                 // still. This race condition, was observed by customer testing.
-                if( (*loop)->DropRegistration() == true ) {
-                    pendingProxies.push_back(*loop);
+                if( loop->second->DropRegistration() == true ) {
+                    pendingProxies.push_back(loop->second);
                 }
                 loop++;
             }
@@ -296,6 +334,8 @@ namespace RPC {
             _channelReferenceMap.erase(remotes);
         }
 
+        _channelArenaMap.Remove(channel.operator->());
+
         _adminLock.Unlock();
     }
 
@@ -4,6 +4,10 @@
 #include "Messages.h"
 #include "Module.h"
 
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
 namespace WPEFramework {
 
 namespace ProxyStub {
@@ -83,9 +87,130 @@ namespace RPC {
             std::atomic<uint32_t> _refCount;
         };
 
-        typedef std::list<ProxyStub::UnknownProxy*> ProxyList;
-        typedef std::map<const Core::IPCChannel*, ProxyList> ChannelMap;
+        // Read-mostly table, sorted on its key. Readers never lock, a writer publishes a changed copy and
+        // deletes the previous one as soon as no reader can be in it anymore.
+        template <typename KEY, typename VALUE>
+        class LookupTableType {
+        private:
+            typedef std::vector<std::pair<KEY, VALUE>> Table;
+
+            LookupTableType(const LookupTableType<KEY, VALUE>&) = delete;
+            LookupTableType<KEY, VALUE>& operator=(const LookupTableType<KEY, VALUE>&) = delete;
+
+        public:
+            LookupTableType()
+                : _lock()
+                , _table(new Table())
+                , _readers(0)
+            {
+            }
+            ~LookupTableType()
+            {
+                delete _table.load();
+            }
+
+        public:
+            bool Find(const KEY& key, VALUE& value) const
+            {
+                bool result = false;
+
+                _readers++;
+
+                const Table* table(_table.load());
+                typename Table::const_iterator index(std::lower_bound(table->begin(), table->end(), key, &LookupTableType<KEY, VALUE>::Before));
+
+                if ((index != table->end()) && (index->first == key)) {
+                    value = index->second;
+                    result = true;
+                }
+
+                _readers--;
+
+                return (result);
+            }
+            void Insert(const KEY& key, const VALUE& value)
+            {
+                _lock.Lock();
+
+                Table* table(new Table(*_table.load()));
+                typename Table::iterator index(std::lower_bound(table->begin(), table->end(), key, &LookupTableType<KEY, VALUE>::Before));
+
+                if ((index != table->end()) && (index->first == key)) {
+                    index->second = value;
+                } else {
+                    table->insert(index, std::pair<KEY, VALUE>(key, value));
+                }
+
+                Publish(table);
+
+                _lock.Unlock();
+            }
+            void Remove(const KEY& key)
+            {
+                _lock.Lock();
+
+                const Table* current(_table.load());
+
+                if (std::binary_search(current->begin(), current->end(), std::pair<KEY, VALUE>(key, VALUE()), &LookupTableType<KEY, VALUE>::Ordered) == true) {
+                    Table* table(new Table(*current));
+
+                    table->erase(std::lower_bound(table->begin(), table->end(), key, &LookupTableType<KEY, VALUE>::Before));
+
+                    Publish(table);
+                }
+
+                _lock.Unlock();
+            }
+
+        private:
+            static bool Before(const std::pair<KEY, VALUE>& element, const KEY& key)
+            {
+                return (std::less<KEY>()(element.first, key));
+            }
+            static bool Ordered(const std::pair<KEY, VALUE>& lhs, const std::pair<KEY, VALUE>& rhs)
+            {
+                return (std::less<KEY>()(lhs.first, rhs.first));
+            }
+            void Publish(Table* table)
+            {
+                Table* previous(_table.exchange(table));
+
+                // Readers that picked up the previous table, are done with it once they left.
+                while (_readers.load() != 0) {
+                    std::this_thread::yield();
+                }
+
+                delete previous;
+            }
+
+        private:
+            Core::CriticalSection _lock;
+            std::atomic<Table*> _table;
+            mutable std::atomic<uint32_t> _readers;
+        };
+
+        // Proxies of a channel, hashed on the implementation they represent and its interface.
+        struct ProxyKey {
+            void* Implementation;
+            uint32_t Id;
+
+            inline bool operator==(const ProxyKey& rhs) const
+            {
+                return ((Implementation == rhs.Implementation) && (Id == rhs.Id));
+            }
+        };
+        struct ProxyHash {
+            inline size_t operator()(const ProxyKey& key) const
+            {
+                return (std::hash<void*>()(key.Implementation) ^ key.Id);
+            }
+        };
+
+        typedef std::unordered_multimap<ProxyKey, ProxyStub::UnknownProxy*, ProxyHash> ProxyList;
+        typedef std::unordered_map<const Core::IPCChannel*, ProxyList> ChannelMap;
         typedef std::map<const Core::IPCChannel*, std::list<ExternalReference>> ReferenceMap;
+        typedef LookupTableType<uint32_t, ProxyStub::UnknownStub*> StubTable;
+        typedef LookupTableType<const Core::IPCChannel*, Core::ProxyType<Data::Arena>> ArenaTable;
 
         struct EXTERNAL IMetadata {
             virtual ~IMetadata(){};
@@ -114,6 +239,14 @@ namespace RPC {
             }
         };
 
+    public:
+        // Allocations done for COM-RPC calls so far. Once the pools are filled, calls should not add to these.
+        struct Metadata {
+            uint32_t Messages;
+            uint32_t Jobs;
+            uint32_t Frames;
+        };
+
     public:
         virtual ~Administrator();
 
@@ -125,7 +258,7 @@ namespace RPC {
         {
             _adminLock.Lock();
 
-            _stubs.insert(std::pair<uint32_t, ProxyStub::UnknownStub*>(ACTUALINTERFACE::ID, new STUB()));
+            _stubs.Insert(ACTUALINTERFACE::ID, new STUB());
             _proxy.insert(std::pair<uint32_t, IMetadata*>(ACTUALINTERFACE::ID, new ProxyType<PROXY>()));
 
             _adminLock.Unlock();
@@ -135,6 +268,19 @@ namespace RPC {
         {
             return (_factory.Element());
         }
+        Metadata Snapshot() const;
+
+        // Buffers of at least this size travel through the shared arena of the connection, 0 keeps them inline.
+        inline uint32_t Threshold() const
+        {
+            return (_threshold);
+        }
+        inline void Threshold(const uint32_t threshold)
+        {
+            _threshold = threshold;
+        }
+        Core::ProxyType<Data::Arena> Arena(const Core::ProxyType<Core::IPCChannel>& channel);
+        void ReleaseArena(const Core::ProxyType<Core::IPCChannel>& channel);
 
         void DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies, std::list<ExposedInterface>& usedInterfaces);
 
@@ -196,6 +342,16 @@ namespace RPC {
         }
 
     private:
+        static ProxyList::iterator Find(ProxyList& proxies, const ProxyKey& key, const ProxyStub::UnknownProxy* proxy)
+        {
+            std::pair<ProxyList::iterator, ProxyList::iterator> range(proxies.equal_range(key));
+
+            while ((range.first != range.second) && (range.first->second != proxy)) {
+                range.first++;
+            }
+
+            return (range.first != range.second ? range.first : proxies.end());
+        }
         Core::IUnknown* Convert(void* rawImplementation, const uint32_t id);
         void* ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t id, const uint32_t interfaceId);
         void* ProxyInstanceQuery(const Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t id, const bool refCounted, const uint32_t interfaceId, const bool piggyBack);
@@ -204,11 +360,13 @@ namespace RPC {
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
         Core::CriticalSection _adminLock;
-        std::map<uint32_t, ProxyStub::UnknownStub*> _stubs;
+        StubTable _stubs;
         std::map<uint32_t, IMetadata*> _proxy;
         Core::ProxyPoolType<InvokeMessage> _factory;
         ChannelMap _channelProxyMap;
         ReferenceMap _channelReferenceMap;
+        ArenaTable _channelArenaMap;
+        uint32_t _threshold;
     };
 
     class EXTERNAL Job : public Core::IDispatch {
@@ -248,6 +406,10 @@ namespace RPC {
         {
             return (_factory.Element());
         }
+        static uint32_t Created()
+        {
+            return (_factory.CreatedElements());
+        }
         void Clear()
         {
             _message.Release();
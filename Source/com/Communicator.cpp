@@ -3,14 +3,26 @@
 #include <limits>
 #include <memory>
 
+#ifdef __LINUX__
+#include <sys/socket.h>
+
+extern char** environ;
+#endif
+
 namespace WPEFramework {
 namespace RPC {
 
     class ProcessShutdown;
 
     static constexpr uint32_t DestructionStackSize = 64 * 1024;
+    static constexpr uint32_t ZygoteRequestSize = 64 * 1024;
     static Core::ProxyPoolType<RPC::AnnounceMessage> AnnounceMessageFactory(2);
-    static Core::TimerType<ProcessShutdown>& _destructor = Core::SingletonType<Core::TimerType<ProcessShutdown>>::Instance(DestructionStackSize, "ProcessDestructor");
+
+    // Created on first use, a host forked by the zygote must not inherit a timer without its thread.
+    static Core::TimerType<ProcessShutdown>& Destructor()
+    {
+        return (Core::SingletonType<Core::TimerType<ProcessShutdown>>::Instance(DestructionStackSize, "ProcessDestructor"));
+    }
 
     class ClosingInfo {
     public:
@@ -37,7 +49,7 @@ namespace RPC {
             uint32_t nextinterval = handler->AttemptClose(0);
 
             if (nextinterval != 0) {
-                _destructor.Schedule(Core::Time::Now().Add(nextinterval), ProcessShutdown(std::move(handler)));
+                Destructor().Schedule(Core::Time::Now().Add(nextinterval), ProcessShutdown(std::move(handler)));
             }
         }
 
@@ -215,6 +227,284 @@ namespace RPC {
         }
     }
 
+    Zygote::Zygote()
+        : _adminLock()
+        , _launchLock()
+        , _command()
+        , _channel(-1)
+        , _pid(0)
+        , _waitTime(0)
+    {
+    }
+
+    Zygote::~Zygote()
+    {
+        Close();
+    }
+
+    uint32_t Zygote::Open(const string& hostApplication, const string& proxyStubPath, const uint32_t waitTime)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+#ifdef __LINUX__
+        int channel[2];
+
+        _adminLock.Lock();
+
+        if ((_channel != -1) || (_pid != 0)) {
+            result = Core::ERROR_ILLEGAL_STATE;
+        } else if (::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, channel) == 0) {
+            // Only the zygote inherits its end of the channel, it leaves once our end is closed.
+            ::fcntl(channel[0], F_SETFD, FD_CLOEXEC);
+
+            Core::Process::Options options(hostApplication);
+            Core::Process zygote(false);
+            uint32_t pid = 0;
+
+            options[_T("-Z")] = Core::NumberType<uint32_t>(channel[1]).Text();
+            if (proxyStubPath.empty() == false) {
+                options[_T("-m")] = '"' + proxyStubPath + '"';
+            }
+
+            result = zygote.Launch(options, &pid);
+
+            ::close(channel[1]);
+
+            if (result == Core::ERROR_NONE) {
+                struct pollfd ready = { channel[0], POLLIN, 0 };
+                uint32_t id = 0;
+
+                // The zygote reports in with its id, as soon as the proxy stubs are loaded.
+                if ((::poll(&ready, 1, (waitTime == Core::infinite ? -1 : static_cast<int>(waitTime))) == 1) && (::recv(channel[0], &id, sizeof(id), 0) == sizeof(id)) && (id == pid)) {
+                    TRACE_L1("Zygote for %s is running: %d.", hostApplication.c_str(), pid);
+                    _command = hostApplication;
+                    _channel = channel[0];
+                    _pid = pid;
+                    _waitTime = waitTime;
+                } else {
+                    result = Core::ERROR_TIMEDOUT;
+                }
+            }
+
+            if (result != Core::ERROR_NONE) {
+                ::close(channel[0]);
+            }
+        }
+
+        _adminLock.Unlock();
+#else
+        DEBUG_VARIABLE(hostApplication);
+        DEBUG_VARIABLE(proxyStubPath);
+        DEBUG_VARIABLE(waitTime);
+#endif
+
+        return (result);
+    }
+
+    void Zygote::Close()
+    {
+#ifdef __LINUX__
+        _adminLock.Lock();
+
+        const int channel = _channel;
+        const uint32_t pid = _pid;
+
+        _channel = -1;
+        _pid = 0;
+
+        if (channel != -1) {
+            // Wakes up a launch that is waiting for the zygote.
+            ::shutdown(channel, SHUT_RDWR);
+        }
+
+        _adminLock.Unlock();
+
+        // Once a launch in progress is done with the channel, it can go.
+        _launchLock.Lock();
+
+        if (channel != -1) {
+            ::close(channel);
+        }
+
+        _launchLock.Unlock();
+
+        if (pid != 0) {
+            // Seeing its channel closed, the zygote leaves right away.
+            ::waitpid(pid, nullptr, 0);
+        }
+#endif
+    }
+
+    uint32_t Zygote::Launch(const Core::Process::Options& options, uint32_t& pid)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+#ifdef __LINUX__
+        // The request holds the arguments, closed by an empty one, followed by the environment.
+        std::vector<char> request;
+        Core::Process::Options::Iterator index(options.Get());
+
+        auto Append = [&request](const char text[]) {
+            request.insert(request.end(), text, text + ::strlen(text) + 1);
+        };
+
+        Append(options.Command().c_str());
+        while (index.Next() == true) {
+            Append(index.Key().c_str());
+            if ((*index).empty() == false) {
+                Append((*index).c_str());
+            }
+        }
+        request.push_back('\0');
+
+        for (char** variable = environ; *variable != nullptr; variable++) {
+            Append(*variable);
+        }
+
+        if (request.size() <= ZygoteRequestSize) {
+            // The replies come in the order of the requests, so one launch at a time. Waiting for
+            // the zygote is not done under the _adminLock, Close can always get in.
+            _launchLock.Lock();
+
+            _adminLock.Lock();
+            const int channel = _channel;
+            const uint32_t waitTime = _waitTime;
+            _adminLock.Unlock();
+
+            if (channel != -1) {
+                struct pollfd ready = { channel, POLLIN, 0 };
+                uint32_t id = 0;
+                ssize_t length = -1;
+
+                if (::send(channel, request.data(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size())) {
+                    int polled;
+
+                    while (((polled = ::poll(&ready, 1, (waitTime == Core::infinite ? -1 : static_cast<int>(waitTime)))) == -1) && (errno == EINTR)) {
+                    }
+
+                    if (polled == 1) {
+                        length = ::recv(channel, &id, sizeof(id), MSG_DONTWAIT);
+                    }
+                }
+
+                if (length != sizeof(id)) {
+                    // A late reply would be taken for the one of the next launch, so a zygote that
+                    // does not answer in time is not used anymore. Without it, the hosts are
+                    // started from scratch again. It is reaped on Close.
+                    _adminLock.Lock();
+
+                    if (_channel == channel) {
+                        TRACE_L1("Zygote %d does not answer, hosts are launched without it.", _pid);
+                        _channel = -1;
+                        ::close(channel);
+                    }
+
+                    _adminLock.Unlock();
+                } else if (id == 0) {
+                    result = Core::ERROR_GENERAL;
+                } else {
+                    pid = id;
+                    result = Core::ERROR_NONE;
+                }
+            }
+
+            _launchLock.Unlock();
+        }
+#else
+        DEBUG_VARIABLE(options);
+        DEBUG_VARIABLE(pid);
+#endif
+
+        return (result);
+    }
+
+    /* static */ bool Zygote::Serve(const int channel, const string& proxyStubPath, std::vector<string>& arguments)
+    {
+        bool forked = false;
+
+#ifdef __LINUX__
+        std::vector<char> request(ZygoteRequestSize);
+        struct sigaction reaper;
+        struct sigaction original;
+        ssize_t length = 0;
+
+        // Nobody waits for the hosts in the zygote, the framework follows them by their id.
+        ::memset(&reaper, 0, sizeof(reaper));
+        sigemptyset(&reaper.sa_mask);
+        reaper.sa_handler = SIG_IGN;
+        reaper.sa_flags = SA_NOCLDWAIT;
+        ::sigaction(SIGCHLD, &reaper, &original);
+
+        if (proxyStubPath.empty() == false) {
+            LoadProxyStubs(proxyStubPath);
+        }
+
+        uint32_t id = static_cast<uint32_t>(::getpid());
+        bool running = (::send(channel, &id, sizeof(id), MSG_NOSIGNAL) == sizeof(id));
+
+        while ((running == true) && (forked == false)) {
+            struct iovec buffer = { request.data(), request.size() };
+            struct msghdr message;
+
+            ::memset(&message, 0, sizeof(message));
+            message.msg_iov = &buffer;
+            message.msg_iovlen = 1;
+
+            length = ::recvmsg(channel, &message, 0);
+
+            if (length <= 0) {
+                running = ((length == -1) && (errno == EINTR));
+            } else {
+                id = 0;
+
+                if (((message.msg_flags & MSG_TRUNC) == 0) && (request[length - 1] == '\0')) {
+                    pid_t child = ::fork();
+
+                    if (child == 0) {
+                        forked = true;
+                    } else if (child > 0) {
+                        id = static_cast<uint32_t>(child);
+                    }
+                }
+
+                if (forked == false) {
+                    running = (::send(channel, &id, sizeof(id), MSG_NOSIGNAL) == sizeof(id));
+                }
+            }
+        }
+
+        if (forked == true) {
+            const char* text = request.data();
+            const char* end = &text[length];
+
+            ::close(channel);
+            ::sigaction(SIGCHLD, &original, nullptr);
+
+            while ((text < end) && (*text != '\0')) {
+                arguments.emplace_back(text);
+                text += arguments.back().length() + 1;
+            }
+
+            ::clearenv();
+
+            while (++text < end) {
+                const char* value = ::strchr(text, '=');
+
+                if (value != nullptr) {
+                    ::setenv(string(text, value - text).c_str(), &value[1], 1);
+                }
+                text += ::strlen(text);
+            }
+        }
+#else
+        DEBUG_VARIABLE(channel);
+        DEBUG_VARIABLE(proxyStubPath);
+        DEBUG_VARIABLE(arguments);
+#endif
+
+        return (forked);
+    }
+
     /* virtual */ uint32_t Communicator::RemoteConnection::Id() const
     {
         return (_id);
@@ -452,6 +742,10 @@ namespace RPC {
             }
         } else {
             TRACE_L1("Connection to the server is down");
+
+            Core::ProxyType<Core::IPCChannel> refChannel(*this);
+
+            RPC::Administrator::Instance().ReleaseArena(refChannel);
         }
     }
 
@@ -261,6 +261,50 @@ namespace RPC {
         string _proxyStub;
     };
 
+    // The zygote is a host application that is started once, up front, with the proxy stubs loaded.
+    // Launching a host through it is a fork of this prepared process, it saves the fork of the (large)
+    // framework process, the exec, the dynamic linking and the loading of the proxy stubs.
+    class EXTERNAL Zygote {
+    public:
+        Zygote(const Zygote&) = delete;
+        Zygote& operator=(const Zygote&) = delete;
+
+        Zygote();
+        ~Zygote();
+
+    public:
+        inline bool IsOpen() const
+        {
+            return (_channel != -1);
+        }
+        inline const string& Command() const
+        {
+            return (_command);
+        }
+        inline uint32_t Id() const
+        {
+            return (_pid);
+        }
+
+        uint32_t Open(const string& hostApplication, const string& proxyStubPath, const uint32_t waitTime);
+        void Close();
+
+        // Request a fork of the zygote, running with the given options and the current environment.
+        uint32_t Launch(const Core::Process::Options& options, uint32_t& pid);
+
+        // Host side of the channel. Returns false in the zygote once the channel is closed and true
+        // in every process forked from it, with the arguments it should run with.
+        static bool Serve(const int channel, const string& proxyStubPath, std::vector<string>& arguments);
+
+    private:
+        Core::CriticalSection _adminLock;
+        Core::CriticalSection _launchLock;
+        string _command;
+        std::atomic<int> _channel;
+        uint32_t _pid;
+        uint32_t _waitTime;
+    };
+
     class EXTERNAL Process {
     public:
         Process() = delete;
@@ -321,15 +365,22 @@ namespace RPC {
         {
             return (_options.Get());
         }
-        uint32_t Launch(uint32_t& id)
+        uint32_t Launch(uint32_t& id, Zygote* zygote = nullptr)
         {
+            uint32_t result = Core::ERROR_UNAVAILABLE;
             uint32_t loggingSettings = (Logging::LoggingType<Logging::Startup>::IsEnabled() ? 0x01 : 0) | (Logging::LoggingType<Logging::Shutdown>::IsEnabled() ? 0x02 : 0) | (Logging::LoggingType<Logging::Notification>::IsEnabled() ? 0x04 : 0);
             _options[_T("-e")] = Core::NumberType<uint32_t>(loggingSettings).Text();
 
-            // Start the external process launch..
-            Core::Process fork(false);
+            if ((zygote != nullptr) && (zygote->Command() == _options.Command())) {
+                result = zygote->Launch(_options, id);
+            }
+
+            if (result != Core::ERROR_NONE) {
+                // Start the external process launch..
+                Core::Process fork(false);
 
-            uint32_t result = fork.Launch(_options, &id);
+                result = fork.Launch(_options, &id);
+            }
 
             if ((result == Core::ERROR_NONE) && (_priority != 0)) {
                 Core::ProcessInfo newProcess(id);
@@ -472,10 +523,11 @@ namespace RPC {
 
             LocalRemoteProcess(const LocalRemoteProcess&) = delete;
             LocalRemoteProcess& operator=(const LocalRemoteProcess&) = delete;
-            LocalRemoteProcess(const Config& config, const Object& instance)
+            LocalRemoteProcess(const Config& config, const Object& instance, Zygote* zygote = nullptr)
                 : _callsign(instance.Callsign())
                 , _id(0)
                 , _process(RemoteConnection::Id(), config, instance)
+                , _zygote(zygote)
             {
             }
             ~LocalRemoteProcess() = default;
@@ -487,7 +539,7 @@ namespace RPC {
             }
             uint32_t Launch() override
             {
-                return (_process.Launch(_id));
+                return (_process.Launch(_id, _zygote));
             }
             const string& Command() const
             {
@@ -511,6 +563,7 @@ namespace RPC {
             string _callsign;
             uint32_t _id;
             Process _process;
+            Zygote* _zygote;
         };
 #ifdef PROCESSCONTAINERS_ENABLED
 
@@ -620,7 +673,7 @@ namespace RPC {
             RemoteConnection* result = nullptr;
 
             if (instance.Type() == Object::HostType::LOCAL) {
-                result = Core::Service<LocalRemoteProcess>::Create<RemoteConnection>(config, instance);
+                result = Core::Service<LocalRemoteProcess>::Create<RemoteConnection>(config, instance, (_zygote.IsOpen() == true ? &_zygote : nullptr));
             }
             else if (instance.Type() == Object::HostType::CONTAINER) {
 #ifdef PROCESSCONTAINERS_ENABLED
@@ -1203,6 +1256,11 @@ namespace RPC {
         {
             _connectionMap.Destroy();
         }
+        // Start the zygote, local hosts of the given application are forked from it from now on.
+        inline uint32_t Preload(const string& hostApplication, const string& proxyStubPath)
+        {
+            return (_zygote.Open(hostApplication, proxyStubPath, CommunicationTimeOut));
+        }
 
     private:
         void Closed(const Core::ProxyType<Core::IPCChannel>& channel)
@@ -1260,6 +1318,7 @@ namespace RPC {
     private:
         RemoteConnectionMap _connectionMap;
         ChannelServer _ipcServer;
+        Zygote _zygote;
     };
 
     class EXTERNAL CommunicatorClient : public Core::IPCChannelClientType<Core::Void, false, true>, public Core::IDispatchType<Core::IIPC> {
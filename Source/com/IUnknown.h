@@ -119,6 +119,7 @@ namespace ProxyStub {
             , _releaseCount(1)
             , _implementation(implementation)
             , _channel(channel)
+            , _arena(RPC::Administrator::Instance().Arena(channel))
             , _parent(*parent)
         {
         }
@@ -146,6 +147,8 @@ namespace ProxyStub {
             Core::ProxyType<RPC::InvokeMessage> message(RPC::Administrator::Instance().Message());
 
             message->Parameters().Set(_implementation, _interfaceId, methodId + 3);
+            message->Parameters().Bind(_arena);
+            message->Response().Bind(_arena);
 
             return (message);
         }
@@ -325,6 +328,7 @@ namespace ProxyStub {
         std::atomic<uint32_t> _releaseCount;
         void* _implementation;
         mutable Core::ProxyType<Core::IPCChannel> _channel;
+        Core::ProxyType<RPC::Data::Arena> _arena;
         Core::IUnknown& _parent;
     };
 
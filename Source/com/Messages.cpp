@@ -0,0 +1,169 @@
+#include "Messages.h"
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace RPC {
+namespace Data {
+
+    namespace {
+
+        // Precedes every buffer in an arena. The owner writes it, the peer flags it released once it is
+        // done with the buffer.
+        struct Chunk {
+            uint32_t Length;
+            std::atomic<uint32_t> State;
+        };
+
+        enum state : uint32_t {
+            IN_USE = 1,
+            RELEASED = 2
+        };
+
+        static const TCHAR ArenaPrefix[] = _T("com.arena.");
+        static std::atomic<uint32_t> g_arenaCount(0);
+
+        inline uint32_t Aligned(const uint32_t length)
+        {
+            return ((length + 7) & (~7));
+        }
+    }
+
+    Arena::Arena(const uint32_t threshold, const uint32_t size)
+        : _adminLock()
+        , _threshold(threshold)
+        , _size(size)
+        , _name()
+        , _local(nullptr)
+        , _remote(nullptr)
+        , _chunks()
+    {
+    }
+
+    Arena::~Arena()
+    {
+        if (_remote != nullptr) {
+            delete _remote;
+        }
+        if (_local != nullptr) {
+            delete _local;
+
+            Core::File(_name).Destroy();
+        }
+    }
+
+    uint8_t* Arena::Allocate(const uint32_t length, uint32_t& offset)
+    {
+        uint8_t* result = nullptr;
+
+        if ((_threshold != 0) && (length >= _threshold)) {
+
+            const uint32_t required = Aligned(sizeof(Chunk) + length);
+
+            _adminLock.Lock();
+
+            if (_local == nullptr) {
+                // The peer opens the arena by name, /dev/shm keeps it out of the filesystem if available.
+                string path(Core::File(_T("/dev/shm/")).IsDirectory() == true ? _T("/dev/shm/") : _T("/tmp/"));
+
+                _name = path + ArenaPrefix + Core::NumberType<uint32_t>(static_cast<uint32_t>(::getpid())).Text() + '.' + Core::NumberType<uint32_t>(g_arenaCount++).Text();
+                _local = new Core::DataElementFile(_name, Core::File::CREATE | Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, _size);
+
+                if ((_local->IsValid() == false) || (_local->Size() < _size)) {
+                    TRACE_L1("Could not create the shared arena %s, buffers go inline.", _name.c_str());
+                }
+            }
+
+            if ((_local->IsValid() == true) && (_local->Size() >= _size)) {
+                uint8_t* base = _local->Buffer();
+                uint32_t position = 0;
+
+                // Everything the peer is done with can be reused.
+                std::map<uint32_t, uint32_t>::iterator index(_chunks.begin());
+
+                while (index != _chunks.end()) {
+                    if (reinterpret_cast<Chunk*>(&(base[index->first]))->State.load(std::memory_order_acquire) == RELEASED) {
+                        index = _chunks.erase(index);
+                    } else {
+                        index++;
+                    }
+                }
+
+                index = _chunks.begin();
+
+                while ((index != _chunks.end()) && ((index->first - position) < required)) {
+                    position = index->first + index->second;
+                    index++;
+                }
+
+                if ((position + required) <= _size) {
+                    Chunk* chunk = reinterpret_cast<Chunk*>(&(base[position]));
+
+                    chunk->Length = length;
+                    chunk->State.store(IN_USE, std::memory_order_relaxed);
+
+                    _chunks.insert(std::pair<uint32_t, uint32_t>(position, required));
+
+                    offset = position;
+                    result = &(base[position + sizeof(Chunk)]);
+                }
+            }
+
+            _adminLock.Unlock();
+        }
+
+        return (result);
+    }
+
+    const uint8_t* Arena::Attach(const string& name, const uint32_t offset, const uint32_t length)
+    {
+        const uint8_t* result = nullptr;
+
+        _adminLock.Lock();
+
+        if ((_remote == nullptr) || (_remote->Name() != name)) {
+            if (_remote != nullptr) {
+                delete _remote;
+                _remote = nullptr;
+            }
+
+            // Only arenas of a peer are to be mapped, not just any file a message points at.
+            if (Core::File::FileNameExtended(name).compare(0, sizeof(ArenaPrefix) - 1, ArenaPrefix) == 0) {
+                _remote = new Core::DataElementFile(name, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE);
+            }
+        }
+
+        if ((_remote != nullptr) && (_remote->IsValid() == true)) {
+            const uint64_t size = _remote->Size();
+
+            if ((offset + static_cast<uint64_t>(sizeof(Chunk)) + length) <= size) {
+                const Chunk* chunk = reinterpret_cast<const Chunk*>(&(_remote->Buffer()[offset]));
+
+                if (chunk->Length == length) {
+                    result = &(_remote->Buffer()[offset + sizeof(Chunk)]);
+                }
+            }
+        }
+
+        if (result == nullptr) {
+            TRACE_L1("Shared buffer %s at %d [%d] is not accessible.", name.c_str(), offset, length);
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void Arena::Release(const uint32_t offset)
+    {
+        _adminLock.Lock();
+
+        ASSERT((_remote != nullptr) && (_remote->IsValid() == true));
+
+        reinterpret_cast<Chunk*>(&(_remote->Buffer()[offset]))->State.store(RELEASED, std::memory_order_release);
+
+        _adminLock.Unlock();
+    }
+}
+}
+} // namespace WPEFramework::RPC::Data
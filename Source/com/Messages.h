@@ -8,18 +8,212 @@ namespace RPC {
 
     namespace Data {
         static const uint16_t IPC_BLOCK_SIZE = 512;
+        static const uint32_t ARENA_SIZE = 1024 * 1024;
+
+        // Shared memory of one connection. Buffers of at least the threshold size are written once in the
+        // arena of the sending side, the frame only carries where to find them. The receiving side maps the
+        // arena of the sender on first use and reads the buffers in place. As soon as the frame that refers
+        // to a buffer is cleared, the receiver marks it released and the sender reuses the space.
+        class EXTERNAL Arena {
+        private:
+            Arena() = delete;
+            Arena(const Arena&) = delete;
+            Arena& operator=(const Arena&) = delete;
+
+        public:
+            Arena(const uint32_t threshold, const uint32_t size);
+            ~Arena();
+
+        public:
+            inline uint32_t Threshold() const
+            {
+                return (_threshold);
+            }
+            inline const string& Name() const
+            {
+                return (_name);
+            }
+
+            // Room for a buffer in our own arena, nullptr if it does not fit. The buffer then goes inline.
+            uint8_t* Allocate(const uint32_t length, uint32_t& offset);
+
+            // A buffer in the arena of the other side, nullptr if it can not be mapped.
+            const uint8_t* Attach(const string& name, const uint32_t offset, const uint32_t length);
+            void Release(const uint32_t offset);
+
+        private:
+            Core::CriticalSection _adminLock;
+            const uint32_t _threshold;
+            const uint32_t _size;
+            string _name;
+            Core::DataElementFile* _local;
+            Core::DataElementFile* _remote;
+            std::map<uint32_t, uint32_t> _chunks;
+        };
 
         class Frame : public Core::FrameType<IPC_BLOCK_SIZE> {
         private:
+            typedef Core::FrameType<IPC_BLOCK_SIZE> BaseClass;
+
+            enum kind : uint8_t {
+                INLINE = 0,
+                SHARED = 1
+            };
+
             Frame(Frame&) = delete;
             Frame& operator=(const Frame&) = delete;
 
+        public:
+            // Every buffer is preceded by its kind: inline, the bytes follow, or shared, the length, offset
+            // and arena name of the buffer follow.
+            class Reader : public BaseClass::Reader {
+            private:
+                Reader& operator=(const Reader&);
+
+            public:
+                Reader()
+                    : BaseClass::Reader()
+                    , _frame(nullptr)
+                    , _shared(false)
+                {
+                }
+                Reader(const Frame& data, const uint16_t offset)
+                    : BaseClass::Reader(data, offset)
+                    , _frame(&data)
+                    , _shared(false)
+                {
+                }
+                Reader(const Reader& copy)
+                    : BaseClass::Reader(copy)
+                    , _frame(copy._frame)
+                    , _shared(copy._shared)
+                {
+                }
+                ~Reader()
+                {
+                }
+
+            public:
+                template <typename TYPENAME>
+                TYPENAME LockBuffer(const uint8_t*& buffer) const
+                {
+                    TYPENAME result;
+
+                    _shared = (Number<uint8_t>() == SHARED);
+
+                    if (_shared == false) {
+                        result = BaseClass::Reader::LockBuffer<TYPENAME>(buffer);
+                    } else {
+                        result = Shared<TYPENAME>(buffer);
+                    }
+
+                    return (result);
+                }
+                template <typename TYPENAME>
+                void UnlockBuffer(TYPENAME length) const
+                {
+                    if (_shared == false) {
+                        BaseClass::Reader::UnlockBuffer<TYPENAME>(length);
+                    }
+                }
+                template <typename TYPENAME>
+                TYPENAME Buffer(const TYPENAME maxLength, uint8_t buffer[]) const
+                {
+                    TYPENAME result;
+
+                    if (Number<uint8_t>() == INLINE) {
+                        result = BaseClass::Reader::Buffer<TYPENAME>(maxLength, buffer);
+                    } else {
+                        const uint8_t* source;
+
+                        result = Shared<TYPENAME>(source);
+
+                        if (result != 0) {
+                            ::memcpy(buffer, source, (result > maxLength ? maxLength : result));
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                template <typename TYPENAME>
+                TYPENAME Shared(const uint8_t*& buffer) const
+                {
+                    ASSERT(_frame != nullptr);
+
+                    TYPENAME length = Number<TYPENAME>();
+                    uint32_t offset = Number<uint32_t>();
+                    string name = Text();
+
+                    buffer = _frame->Attach(name, offset, length);
+
+                    return (buffer != nullptr ? length : 0);
+                }
+
+            private:
+                const Frame* _frame;
+                mutable bool _shared;
+            };
+            class Writer : public BaseClass::Writer {
+            private:
+                Writer& operator=(const Writer&);
+
+            public:
+                Writer()
+                    : BaseClass::Writer()
+                    , _frame(nullptr)
+                {
+                }
+                Writer(Frame& data, const uint16_t offset)
+                    : BaseClass::Writer(data, offset)
+                    , _frame(&data)
+                {
+                }
+                Writer(const Writer& copy)
+                    : BaseClass::Writer(copy)
+                    , _frame(copy._frame)
+                {
+                }
+                ~Writer()
+                {
+                }
+
+            public:
+                template <typename TYPENAME>
+                void Buffer(const TYPENAME length, const uint8_t buffer[])
+                {
+                    ASSERT(_frame != nullptr);
+
+                    uint32_t offset = 0;
+                    uint8_t* destination = _frame->Allocate(length, offset);
+
+                    if (destination == nullptr) {
+                        Number<uint8_t>(INLINE);
+                        BaseClass::Writer::Buffer<TYPENAME>(length, buffer);
+                    } else {
+                        ::memcpy(destination, buffer, length);
+
+                        Number<uint8_t>(SHARED);
+                        Number<TYPENAME>(length);
+                        Number<uint32_t>(offset);
+                        Text(_frame->_arena->Name());
+                    }
+                }
+
+            private:
+                Frame* _frame;
+            };
+
         public:
             Frame()
+                : _arena()
+                , _attached()
             {
             }
             ~Frame()
             {
+                Detach();
             }
 
         public:
@@ -27,6 +221,24 @@ namespace RPC {
             friend class Output;
             friend class ObjectInterface;
 
+            inline void Clear()
+            {
+                Detach();
+                if (_arena.IsValid() == true) {
+                    _arena.Release();
+                }
+                BaseClass::Clear();
+            }
+            // Large buffers written in this frame go through the arena, buffers read from it come from there.
+            inline void Bind(const Core::ProxyType<Arena>& arena)
+            {
+                _arena = arena;
+            }
+
+            inline const uint8_t* Data() const
+            {
+                return (Size() > 0 ? &(operator[](0)) : nullptr);
+            }
             uint16_t Serialize(const uint16_t offset, uint8_t stream[], const uint16_t maxLength) const
             {
                 uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
@@ -43,6 +255,45 @@ namespace RPC {
 
                 return (maxLength);
             }
+
+        private:
+            uint8_t* Allocate(const uint32_t length, uint32_t& offset)
+            {
+                uint8_t* result = nullptr;
+
+                if ((_arena.IsValid() == true) && (length >= _arena->Threshold())) {
+                    result = _arena->Allocate(length, offset);
+                }
+
+                return (result);
+            }
+            const uint8_t* Attach(const string& name, const uint32_t offset, const uint32_t length) const
+            {
+                const uint8_t* result = nullptr;
+
+                if (_arena.IsValid() == false) {
+                    TRACE_L1("Shared buffer received on a frame without an arena. %d", __LINE__);
+                } else if ((result = _arena->Attach(name, offset, length)) != nullptr) {
+                    _attached.push_back(offset);
+                }
+
+                return (result);
+            }
+            void Detach()
+            {
+                if (_attached.empty() == false) {
+                    ASSERT(_arena.IsValid() == true);
+
+                    for (const uint32_t offset : _attached) {
+                        _arena->Release(offset);
+                    }
+                    _attached.clear();
+                }
+            }
+
+        private:
+            Core::ProxyType<Arena> _arena;
+            mutable std::vector<uint32_t> _attached;
         };
 
         class Input {
@@ -64,6 +315,10 @@ namespace RPC {
             {
                 _data.Clear();
             }
+            inline void Bind(const Core::ProxyType<Arena>& arena)
+            {
+                _data.Bind(arena);
+            }
             void Set(void* implementation, const uint32_t interfaceId, const uint8_t methodId)
             {
                 uint16_t result = _data.SetNumber<void*>(0, implementation);
@@ -99,6 +354,10 @@ namespace RPC {
             {
                 return (_data.Size());
             }
+            inline const uint8_t* Data() const
+            {
+                return (_data.Data());
+            }
             inline Frame::Writer Writer()
             {
                 return (Frame::Writer(_data, (sizeof(void*) + sizeof(uint32_t) + sizeof(uint8_t))));
@@ -139,6 +398,10 @@ namespace RPC {
             {
                 _data.Clear();
             }
+            inline void Bind(const Core::ProxyType<Arena>& arena)
+            {
+                _data.Bind(arena);
+            }
             inline Frame::Writer Writer()
             {
                 return (Frame::Writer(_data, 0));
@@ -156,6 +419,10 @@ namespace RPC {
             {
                 return (static_cast<uint32_t>(_data.Size()));
             }
+            inline const uint8_t* Data() const
+            {
+                return (_data.Data());
+            }
             inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
                 return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
@@ -206,27 +206,10 @@ namespace Core {
 
             foundData = true;
 
-            uint32_t roundCount = oldTail / (1 + _administration->_tailIndexMask);
-            if ((offset + result) < _maxSize) {
-                memcpy(buffer, _realBuffer + offset, result);
+            CopyOut(buffer, offset, result);
 
-                uint32_t newTail = offset + result + roundCount * (1 + _administration->_tailIndexMask);
-                if (!std::atomic_compare_exchange_weak(&(_administration->_tail), &oldTail, newTail)) {
-                    foundData = false;
-                }
-            } else {
-                uint32_t part1(_maxSize - offset);
-                uint32_t part2(result - part1);
-
-                memcpy(buffer, _realBuffer + offset, part1);
-                memcpy(buffer + part1, _realBuffer, part2);
-
-                // Add one round, but prevent overflow.
-                roundCount = (roundCount + 1) % _administration->_roundCountModulo;
-                uint32_t newTail = part2 + roundCount * (1 + _administration->_tailIndexMask);
-                if (!std::atomic_compare_exchange_weak(&(_administration->_tail), &oldTail, newTail)) {
-                    foundData = false;
-                }
+            if (!std::atomic_compare_exchange_weak(&(_administration->_tail), &oldTail, cursor.GetCompleteTail(result))) {
+                foundData = false;
             }
         }
 
@@ -281,17 +264,8 @@ namespace Core {
 
         // Perform actual copy.
         uint32_t writeEnd = (writeStart + length) % _maxSize;
-        if (writeEnd > writeStart) {
-            // Easy case: one pass.
-            memcpy(_realBuffer + writeStart, buffer, length);
-        } else {
-            // Copying beyond end of buffer, do in two passes.
-            uint32_t firstLength = _maxSize - writeStart;
-            uint32_t secondLength = length - firstLength;
 
-            memcpy(_realBuffer + writeStart, buffer, firstLength);
-            memcpy(_realBuffer, buffer + firstLength, secondLength);
-        }
+        CopyIn(writeStart, buffer, length);
 
         if (shouldMoveHead) {
             _administration->_head = writeEnd;
@@ -319,12 +293,14 @@ namespace Core {
         uint32_t free = Free(head, tail);
 
         while (free <= required) {
-            uint32_t remaining = required - free;
+            // One more than required, to differentiate between a full and an empty buffer. The tail must stay
+            // on the boundary GetOverwriteSize returns, otherwise the next overwrite does not find a frame there.
+            uint32_t remaining = required - free + 1;
             Cursor cursor(*this, oldTail, remaining);
             uint32_t offset = GetOverwriteSize(cursor);
-            ASSERT((offset + free) >= required);
+            ASSERT((offset + free) > required);
 
-            uint32_t newTail = (cursor.GetCompleteTail(offset) + 1); // Differentiate between full and empty buffer.
+            uint32_t newTail = cursor.GetCompleteTail(offset);
 
             if (!std::atomic_compare_exchange_weak(&(_administration->_tail), &oldTail, newTail)) {
                 tail = oldTail & _administration->_tailIndexMask;
@@ -453,7 +429,7 @@ namespace Core {
         while (!foundData) {
             uint32_t oldTail = _administration->_tail;
             uint32_t tail = oldTail & _administration->_tailIndexMask;
-            result = Used(_administration->_head, oldTail);
+            result = Used(_administration->_head, tail);
 
             if (result == 0) {
                 // No data.
@@ -465,19 +441,7 @@ namespace Core {
                 result = length;
             }
 
-            uint32_t readEnd = tail + result;
-
-            if (readEnd < _maxSize) {
-                // Can be done in one pass.
-                memcpy(buffer, _realBuffer + tail, result);
-            } else {
-                // Needs to be done in two passes.
-                uint32_t firstLength = _maxSize - tail;
-                uint32_t secondLength = length - firstLength;
-
-                memcpy(buffer, _realBuffer + tail, firstLength);
-                memcpy(buffer + firstLength, _realBuffer, secondLength);
-            }
+            CopyOut(buffer, tail, result);
 
             // We found valid data if the tail is still where it was when we started.
             foundData = (_administration->_tail == oldTail);
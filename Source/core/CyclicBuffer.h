@@ -53,12 +53,7 @@ namespace Core {
                 startIndex += _Offset;
                 startIndex %= _Parent._maxSize;
 
-                uint8_t* bytePtr = reinterpret_cast<uint8_t*>(&buffer);
-
-                for (uint32_t i = 0; i < sizeof(buffer); i++) {
-                    uint32_t index = (startIndex + i) % _Parent._maxSize;
-                    bytePtr[i] = _Parent._realBuffer[index];
-                }
+                _Parent.CopyOut(reinterpret_cast<uint8_t*>(&buffer), startIndex, sizeof(buffer));
             }
 
             uint32_t Size() const
@@ -123,6 +118,35 @@ namespace Core {
             return result;
         }
 
+        // Copy data from/to the buffer, starting at index. At most two memcpy's, one up till the end of the
+        // buffer and one for what wrapped around to the start.
+        inline void CopyOut(uint8_t destination[], const uint32_t index, const uint32_t length) const
+        {
+            ASSERT((index < _maxSize) && (length <= _maxSize));
+
+            if ((index + length) <= _maxSize) {
+                ::memcpy(destination, &(_realBuffer[index]), length);
+            } else {
+                const uint32_t firstLength = _maxSize - index;
+
+                ::memcpy(destination, &(_realBuffer[index]), firstLength);
+                ::memcpy(&(destination[firstLength]), _realBuffer, length - firstLength);
+            }
+        }
+        inline void CopyIn(const uint32_t index, const uint8_t source[], const uint32_t length)
+        {
+            ASSERT((index < _maxSize) && (length <= _maxSize));
+
+            if ((index + length) <= _maxSize) {
+                ::memcpy(&(_realBuffer[index]), source, length);
+            } else {
+                const uint32_t firstLength = _maxSize - index;
+
+                ::memcpy(&(_realBuffer[index]), source, firstLength);
+                ::memcpy(_realBuffer, &(source[firstLength]), length - firstLength);
+            }
+        }
+
     public:
         inline void Flush()
         {
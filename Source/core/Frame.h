@@ -3,12 +3,16 @@
 
 #include "Module.h"
 
+#include <atomic>
+
 namespace WPEFramework {
 namespace Core {
 
     template <const uint16_t BLOCKSIZE>
     class FrameType {
     private:
+        // Frames with a blocksize keep the first block inline, only if they grow beyond it, memory comes from
+        // the heap. Frames without a blocksize work on a buffer handed to them.
         template <const uint16_t STARTSIZE>
         class AllocatorType {
         private:
@@ -17,17 +21,18 @@ namespace Core {
         public:
             AllocatorType()
                 : _bufferSize(STARTSIZE)
-                , _data(reinterpret_cast<uint8_t*>(::malloc(_bufferSize)))
+                , _data(_inline)
             {
                 static_assert(STARTSIZE != 0, "This method can only be called if you specify an initial blocksize");
             }
             AllocatorType(const AllocatorType<STARTSIZE>& copy)
-                : _bufferSize(copy._bufferSize)
-                , _data(STARTSIZE == 0 ? copy._data : reinterpret_cast<uint8_t*>(::malloc(_bufferSize)))
+                : _bufferSize(STARTSIZE == 0 ? copy._bufferSize : STARTSIZE)
+                , _data(STARTSIZE == 0 ? copy._data : _inline)
             {
 
                 if (STARTSIZE != 0) {
-                    ::memcpy(_data, copy._data, _bufferSize);
+                    Allocate(copy._bufferSize);
+                    ::memcpy(_data, copy._data, copy._bufferSize);
                 }
             }
             AllocatorType(uint8_t buffer[], const uint32_t length)
@@ -38,7 +43,7 @@ namespace Core {
             }
             ~AllocatorType()
             {
-                if ((STARTSIZE != 0) && (_data != nullptr)) {
+                if ((STARTSIZE != 0) && (_data != _inline)) {
                     ::free(_data);
                 }
             }
@@ -60,6 +65,12 @@ namespace Core {
             {
                 RealAllocate<STARTSIZE>(requiredSize, TemplateIntToType<STARTSIZE>());
             }
+            static std::atomic<uint32_t>& Allocations()
+            {
+                static std::atomic<uint32_t> allocations(0);
+
+                return (allocations);
+            }
 
         private:
             template <const uint16_t NONZEROSIZE>
@@ -67,10 +78,17 @@ namespace Core {
             {
                 if (requiredSize > _bufferSize) {
 
-                    _bufferSize = static_cast<uint16_t>(((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE);
+                    _bufferSize = ((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE;
 
                     // oops we need to "reallocate".
-                    _data = reinterpret_cast<uint8_t*>(::realloc(_data, _bufferSize));
+                    if (_data == _inline) {
+                        _data = reinterpret_cast<uint8_t*>(::malloc(_bufferSize));
+                        ::memcpy(_data, _inline, STARTSIZE);
+                    } else {
+                        _data = reinterpret_cast<uint8_t*>(::realloc(_data, _bufferSize));
+                    }
+
+                    Allocations()++;
                 }
             }
             inline void RealAllocate(const uint32_t requiredSize, const TemplateIntToType<0>& /* For compile time diffrentiation */)
@@ -79,13 +97,21 @@ namespace Core {
             }
 
         private:
-            uint16_t _bufferSize;
+            uint32_t _bufferSize;
             uint8_t* _data;
+            uint8_t _inline[STARTSIZE == 0 ? 1 : STARTSIZE];
         };
 
     private:
         FrameType& operator=(const FrameType&);
 
+    public:
+        // Number of times frames of this blocksize needed memory beyond their inline block.
+        static uint32_t Allocations()
+        {
+            return (AllocatorType<BLOCKSIZE>::Allocations().load());
+        }
+
     public:
         class Reader {
         private:
@@ -18,7 +18,22 @@ namespace Core {
     struct IMessage {
     public:
         typedef IMessage BaseElement;
-        typedef uint32_t Identifier;
+
+        // Once both sides know the other can handle it, a frame carries, next to the label of the message, the
+        // sequence of the call it belongs to. A response echoes the sequence of its request, so multiple calls
+        // can be in flight on one channel. A frame with a sequence has the SEQUENCED bit set in its label, a
+        // frame without one is laid out as it always was. Each side announces it reads sequences by sending a
+        // HANDSHAKE frame as soon as the channel opens, a side that does not know it, drops it as a response
+        // to a call it never made. Only than sequences are sent, so labels must stay below 0x08000000.
+        enum : uint32_t {
+            SEQUENCED = 0x10000000,
+            HANDSHAKE = 0x1FFFFFFF
+        };
+
+        struct Identifier {
+            uint32_t Label;
+            uint32_t Sequence;
+        };
 
         class Serializer {
         private:
@@ -47,6 +62,8 @@ namespace Core {
                 // Serialize will not start processing until the current (and
                 // thius all other parameters) are set correctly.
                 _length = element.Length();
+                _sequence = element.Sequence();
+                _label = element.Label() | (_sequence != 0 ? SEQUENCED : 0);
                 _offset = 0;
                 _current = &element;
 
@@ -62,7 +79,7 @@ namespace Core {
 
                 while ((_current != nullptr) && (result < maxLength)) {
                     if (_offset < 4) {
-                        uint32_t length = _length + CommandSize();
+                        uint32_t length = _length + HeaderSize();
 
                         // Write the length. Continue as long as the top bt is active..
                         while ((_offset < 4) && (result < maxLength)) {
@@ -80,7 +97,7 @@ namespace Core {
 
                     // Write the command, Same structure as length..
                     while ((_offset < 8) && (result < maxLength)) {
-                        uint32_t value = _current->Label() >> (7 * (_offset - 4));
+                        uint32_t value = _label >> (7 * (_offset - 4));
                         stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
                         result++;
 
@@ -91,16 +108,33 @@ namespace Core {
                         }
                     }
 
+                    if ((_offset == 8) && (_sequence == 0)) {
+                        _offset = 12;
+                    }
+
+                    // Write the sequence, Same structure as length..
+                    while ((_offset < 12) && (result < maxLength)) {
+                        uint32_t value = _sequence >> (7 * (_offset - 8));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+
+                        if (value >= 0x80) {
+                            _offset++;
+                        } else {
+                            _offset = 12;
+                        }
+                    }
+
                     if (result < maxLength) {
                         // Write the command, Same structure as length..
-                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 8);
+                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 12);
 
                         result += handled;
                         _offset += handled;
 
-                        ASSERT_VERBOSE((_offset - 8) <= _length, "%d <= %d", (_offset - 8), _length);
+                        ASSERT_VERBOSE((_offset - 12) <= _length, "%d <= %d", (_offset - 12), _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - 12) == _length) {
                             const IMessage* ready = _current;
                             _current = nullptr;
 
@@ -112,18 +146,78 @@ namespace Core {
 
                 return (result);
             }
+            // A message that is kept in one block, and is large enough to be worth it, is handed to the socket
+            // as is, next to its header, instead of being copied into the send buffer piece by piece.
+            uint16_t Gather(SocketPort::Slice slices[], const uint16_t maxSlices)
+            {
+                uint16_t result = 0;
+
+                if ((_current != nullptr) && (_offset == 0) && (maxSlices >= 2) && (_length >= GatherThreshold)) {
+                    const uint8_t* data = _current->Data();
+
+                    if (data != nullptr) {
+                        uint8_t size = Encode(&(_header[0]), _length + HeaderSize());
+                        size += Encode(&(_header[size]), _label);
+                        if (_sequence != 0) {
+                            size += Encode(&(_header[size]), _sequence);
+                        }
+
+                        slices[0].Buffer = _header;
+                        slices[0].Size = size;
+                        slices[1].Buffer = data;
+                        slices[1].Size = _length;
+
+                        // Everything is handed out, Gathered() reports it once it is sent.
+                        _offset = 12 + _length;
+                        result = 2;
+                    }
+                }
+
+                return (result);
+            }
+            void Gathered()
+            {
+                if ((_current != nullptr) && (_offset == (12 + _length))) {
+                    const IMessage* ready = _current;
+                    _current = nullptr;
+
+                    Serialized(*ready);
+                }
+            }
             virtual void Serialized(const IMessage& element) = 0;
 
         private:
-            inline uint32_t CommandSize() const
+            static constexpr uint32_t GatherThreshold = 1024;
+
+            // Same encoding as the incremental one in Serialize.
+            static inline uint8_t Encode(uint8_t stream[], const uint32_t value)
             {
-                return (_current->Label() > 0x1FFFFF ? 4 : (_current->Label() > 0xCFFF ? 3 : (_current->Label() > 0x7F ? 2 : 1)));
+                uint8_t result = 0;
+                uint32_t part;
+
+                do {
+                    part = value >> (7 * result);
+                    stream[result++] = ((part & 0x7F) | (part >= 0x80 ? 0x80 : 0x00));
+                } while ((part >= 0x80) && (result < 4));
+
+                return (result);
+            }
+            static inline uint8_t VariableSize(const uint32_t value)
+            {
+                return (value > 0x1FFFFF ? 4 : (value > 0x3FFF ? 3 : (value > 0x7F ? 2 : 1)));
+            }
+            inline uint8_t HeaderSize() const
+            {
+                return (VariableSize(_label) + (_sequence != 0 ? VariableSize(_sequence) : 0));
             }
 
         private:
             uint32_t _length;
+            uint32_t _label;
+            uint32_t _sequence;
             uint32_t _offset;
             const IMessage* _current;
+            uint8_t _header[12];
         };
 
         class Deserializer {
@@ -136,6 +230,7 @@ namespace Core {
                 : _length(0)
                 , _offset(0)
                 , _label(0)
+                , _sequence(0)
                 , _current(nullptr)
             {
             }
@@ -145,15 +240,15 @@ namespace Core {
 
         public:
             virtual void Deserialized(IMessage& element) = 0;
-            virtual IMessage* Element(const uint32_t& label) = 0;
+            virtual IMessage* Element(const Identifier& identifier) = 0;
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
             {
                 uint16_t result = 0;
 
                 while (result < maxLength) {
-					if ((_current == nullptr) && (_offset < 8)) {
-                        // We have nothing, start by getting the length/command
+                    if ((_current == nullptr) && (_offset < 12)) {
+                        // We have nothing, start by getting the length/command/sequence
                         while ((_offset < 4) && (result < maxLength)) {
                             _length |= ((stream[result] & (_offset == 3 ? 0xFF : 0x7F)) << (7 * _offset));
 
@@ -175,37 +270,58 @@ namespace Core {
                             }
                         }
 
-                        if (_offset == 8) {
-                            _current = Element(_label);
+                        if ((_offset == 8) && (((_label & SEQUENCED) == 0) || (_label == HANDSHAKE))) {
+                            // Laid out as it always was, there is no sequence.
+                            _offset = 12;
+                        }
+
+                        while ((_offset < 12) && (result < maxLength)) {
+                            _sequence |= ((stream[result] & (_offset == 11 ? 0xFF : 0x7F)) << (7 * (_offset - 8)));
+                            _length--;
+
+                            if ((stream[result++] & 0x80) != 0) {
+                                _offset++;
+                            } else {
+                                _offset = 12;
+                            }
+                        }
+
+                        if (_offset == 12) {
+                            const Identifier identifier = { (_label == HANDSHAKE ? _label : (_label & ~SEQUENCED)), _sequence };
+                            _current = Element(identifier);
                             _label = 0;
+                            _sequence = 0;
                         }
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    // The header might not be complete yet, than all there was, is read.
+                    if (_offset >= 12) {
+                        ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) < _length) {
+                        if ((_offset - 12) < _length) {
 
-                        // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 8)) ? static_cast<uint16_t>(_length - (_offset - 8)) : (maxLength - result));
+                            // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
+                            uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 12)) ? static_cast<uint16_t>(_length - (_offset - 12)) : (maxLength - result));
 
-                        if (_current != nullptr) {
-                            handled = _current->Deserialize(&stream[result], handled, _offset - 8);
-                        }
+                            if (_current != nullptr) {
+                                handled = _current->Deserialize(&stream[result], handled, _offset - 12);
+                            }
 
-                        _offset += handled;
-                        result += handled;
-                    }
+                            _offset += handled;
+                            result += handled;
+                        }
 
-                    ASSERT((_offset - 8) <= _length);
+                        ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) == _length) {
-                        if (_current != nullptr) {
-                            IMessage* ready = _current;
-                            _current = nullptr;
-                            Deserialized(*ready);
+                        if ((_offset - 12) == _length) {
+                            if (_current != nullptr) {
+                                IMessage* ready = _current;
+                                _current = nullptr;
+                                Deserialized(*ready);
+                            }
+                            _offset = 0;
+                            _length = 0;
                         }
-                        _offset = 0;
-                        _length = 0;
                     }
                 }
                 return (result);
@@ -215,6 +331,7 @@ namespace Core {
             uint32_t _length;
             uint32_t _offset;
             uint32_t _label;
+            uint32_t _sequence;
             IMessage* _current;
         };
 
@@ -222,9 +339,17 @@ namespace Core {
         virtual ~IMessage() {}
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
         virtual uint32_t Length() const = 0;
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
+
+        // If the content of the message is kept in one block of Length() bytes, it can be sent from there
+        // without copying it into the send buffer first.
+        virtual const uint8_t* Data() const
+        {
+            return (nullptr);
+        }
     };
 
     struct EXTERNAL IIPC {
@@ -232,6 +357,8 @@ namespace Core {
         virtual ~IIPC();
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
+        virtual void Sequence(const uint32_t sequence) = 0;
         virtual ProxyType<IMessage> IParameters() = 0;
         virtual ProxyType<IMessage> IResponse() = 0;
     };
@@ -285,6 +412,10 @@ namespace Core {
             {
                 return (REALIDENTIFIER);
             }
+            virtual uint32_t Sequence() const
+            {
+                return (_parent.Sequence());
+            }
             virtual uint32_t Length() const
             {
                 return (_Length<PACKAGE, REALIDENTIFIER>());
@@ -297,6 +428,10 @@ namespace Core {
             {
                 return (_Deserialize<PACKAGE, REALIDENTIFIER>(stream, maxLength, offset));
             }
+            virtual const uint8_t* Data() const
+            {
+                return (_Data<PACKAGE, REALIDENTIFIER>());
+            }
             virtual void AddRef() const
             {
                 _parent.AddRef();
@@ -373,6 +508,24 @@ namespace Core {
                 return (result);
             }
 
+            HAS_MEMBER(Data, hasData);
+
+            typedef hasData<PACKAGE, const uint8_t* (PACKAGE::*)() const> TraitData;
+
+            template <typename SUBJECT, const uint32_t ID>
+            inline typename Core::TypeTraits::enable_if<RawSerializedType<SUBJECT, ID>::TraitData::value, const uint8_t*>::type
+            _Data() const
+            {
+                return (_package.Data());
+            }
+
+            template <typename SUBJECT, const uint32_t ID>
+            inline typename Core::TypeTraits::enable_if<!RawSerializedType<SUBJECT, ID>::TraitData::value, const uint8_t*>::type
+            _Data() const
+            {
+                return (nullptr);
+            }
+
             HAS_MEMBER(Deserialize, hasDeserialize);
 
             typedef hasDeserialize<PACKAGE, uint16_t (PACKAGE::*)(const uint8_t[], const uint16_t, const uint32_t)> TraitDeserialize;
@@ -416,11 +569,13 @@ namespace Core {
         IPCMessageType()
             : _parameters(*this)
             , _response(*this)
+            , _sequence(0)
         {
         }
         IPCMessageType(const PARAMETERS& info)
             : _parameters(*this, info)
             , _response(*this)
+            , _sequence(0)
         {
         }
 #ifdef __WINDOWS__
@@ -453,6 +608,14 @@ namespace Core {
         {
             return (IDENTIFIER);
         }
+        virtual uint32_t Sequence() const
+        {
+            return (_sequence);
+        }
+        virtual void Sequence(const uint32_t sequence)
+        {
+            _sequence = sequence;
+        }
         virtual ProxyType<IMessage> IParameters()
         {
             return ProxyType<IMessage>(&_parameters, &_parameters);
@@ -470,6 +633,7 @@ namespace Core {
     private:
         RawSerializedType<PARAMETERS, (IDENTIFIER << 1)> _parameters;
         RawSerializedType<RESPONSE, ((IDENTIFIER << 1) | 0x1)> _response;
+        uint32_t _sequence;
     };
 
     class EXTERNAL IPCChannel {
@@ -482,6 +646,24 @@ namespace Core {
         private:
             friend IPCChannel;
 
+            // Calls that are send out and wait for a response. The slots are reused, a free slot has no call, so
+            // once there is room for the calls that are in flight at the same time, no allocations follow.
+            struct Outbound {
+                uint32_t Sequence;
+                ProxyType<IIPC> Call;
+                IDispatchType<IIPC>* Callback;
+            };
+            typedef std::vector<Outbound> OutboundList;
+
+            // The calls that timed out last, to recognize their responses if they still come in.
+            static constexpr uint8_t ExpiredSlots = 8;
+
+        public:
+            // The sequence of a call that is aborted, as the channel went down.
+            static constexpr uint32_t Aborted = ~0;
+
+        private:
+
             IPCFactory(const IPCFactory& copy) = delete;
             IPCFactory& operator=(const IPCFactory&) = delete;
 
@@ -489,7 +671,12 @@ namespace Core {
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _pending(0)
+                , _sequence(0)
+                , _pipelined(false)
+                , _expired()
+                , _expiredIndex(0)
+                , _late(0)
                 , _factory()
                 , _handlers()
             {
@@ -506,7 +693,12 @@ namespace Core {
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _pending(0)
+                , _sequence(0)
+                , _pipelined(false)
+                , _expired()
+                , _expiredIndex(0)
+                , _late(0)
                 , _factory(factory)
                 , _handlers()
             {
@@ -559,21 +751,59 @@ namespace Core {
 
             inline bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+
+                bool result = (_pending != 0);
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Does the other side read sequences, so calls can go out while others are in flight.
+            inline bool IsPipelined() const
+            {
+                _lock.Lock();
+
+                bool result = _pipelined;
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Responses that came in after their call timed out.
+            inline uint32_t LateResponses() const
+            {
+                _lock.Lock();
+
+                uint32_t result = _late;
+
+                _lock.Unlock();
+
+                return (result);
             }
 
-            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            inline ProxyType<IMessage> Element(const IMessage::Identifier& identifier)
             {
                 ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
+                uint32_t searchIdentifier(identifier.Label >> 1);
 
                 _lock.Lock();
 
-                if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
+                if (identifier.Label == IMessage::HANDSHAKE) {
+                    TRACE_L1("The other side reads sequences, calls are pipelined from now on. %d", __LINE__);
+                    _pipelined = true;
+                } else if (identifier.Label & 0x01) {
+                    OutboundList::iterator index(Find(identifier.Sequence));
+
+                    if ((index != _outbound.end()) && (index->Call->Label() == searchIdentifier)) {
+                        result = index->Call->IResponse();
+                    } else if (Expired(searchIdentifier, identifier.Sequence) == true) {
+                        _late++;
+                        TRACE_L1("Response for ID [%d], sequence [%d] came in after the call timed out, dropped.\n", searchIdentifier, identifier.Sequence);
                     } else {
-                        TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
+                        TRACE_L1("Unexpected response message for ID [%d], sequence [%d].\n", searchIdentifier, identifier.Sequence);
                     }
                 } else {
                     ASSERT(_inbound.IsValid() == false);
@@ -581,6 +811,8 @@ namespace Core {
                     ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
 
                     if (rpcCall.IsValid() == true) {
+                        // The response goes out with the sequence of this request.
+                        rpcCall->Sequence(identifier.Sequence);
                         _inbound = rpcCall;
                         result = rpcCall->IParameters();
                     } else {
@@ -599,15 +831,21 @@ namespace Core {
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
-
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
+                for (Outbound& entry : _outbound) {
+                    Free(entry);
                 }
+
                 if (_inbound.IsValid() == true) {
                     _inbound.Release();
                 }
 
+                // The next connection might well be with someone else.
+                _pipelined = false;
+
+                for (IMessage::Identifier& entry : _expired) {
+                    entry.Label = 0;
+                }
+
                 _lock.Unlock();
             }
 
@@ -617,15 +855,20 @@ namespace Core {
 
                 _lock.Lock();
 
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                if ((rhs->Label() & 0x01) != 0) {
+                    OutboundList::iterator index(Find(rhs->Sequence()));
+
+                    // If the call was aborted while its response was read, there is no one to report it to.
+                    if ((index != _outbound.end()) && (index->Call->IResponse() == rhs)) {
 
-                    ASSERT(_callback != nullptr);
+                        ASSERT(index->Callback != nullptr);
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                        ProxyType<IIPC> handledObject(index->Call);
+                        IDispatchType<IIPC>* callback(index->Callback);
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                        Free(*index);
+                        callback->Dispatch(*handledObject);
+                    }
                 }
                 // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
                 else if (_inbound.IsValid() == true) {
@@ -651,37 +894,98 @@ namespace Core {
                 return (procedure);
             }
 
+            // Registers the call as in flight. Register before submitting, the response might be in before the
+            // submit returns. As long as the other side does not read sequences, the call goes out without one,
+            // and it should be the only call in flight.
             inline void SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
             {
                 _lock.Lock();
 
                 ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
+                ASSERT((_pipelined == true) || (_pending == 0));
+
+                uint32_t sequence = 0;
 
-                _outbound = outbound;
-                _callback = callback;
+                if (_pipelined == true) {
+                    // Sequence 0 is never handed out, it marks a frame without a sequence. Keep it within
+                    // 28 bits, so it is at most 4 bytes in the frame header.
+                    do {
+                        _sequence = (_sequence + 1) & 0x0FFFFFFF;
+                    } while ((_sequence == 0) || (Find(_sequence) != _outbound.end()));
+
+                    sequence = _sequence;
+                }
+
+                OutboundList::iterator index(_outbound.begin());
+
+                while ((index != _outbound.end()) && (index->Call.IsValid() == true)) {
+                    index++;
+                }
+
+                if (index == _outbound.end()) {
+                    _outbound.emplace_back();
+                    index = _outbound.end() - 1;
+                }
+
+                outbound->Sequence(sequence);
+                index->Sequence = sequence;
+                index->Call = outbound;
+                index->Callback = callback;
+                _pending++;
 
                 _lock.Unlock();
             }
 
-            inline bool AbortOutbound()
+            // Stop waiting for the call, as it timed out. Returns false if the call was already completed (or
+            // aborted) in the mean time, the callback is than already dispatched.
+            inline bool AbortOutbound(const Core::ProxyType<IIPC>& outbound)
             {
                 bool result = false;
 
                 _lock.Lock();
 
-                if (_outbound.IsValid() == true) {
+                OutboundList::iterator index(_outbound.begin());
 
-                    result = true;
+                while ((index != _outbound.end()) && (index->Call != outbound)) {
+                    index++;
+                }
 
-                    if (_callback != nullptr) {
-                        _callback->Dispatch(*_outbound);
-                        _callback = nullptr;
+                if (index != _outbound.end()) {
+                    // Without a sequence, a late response can not be told apart from the one of the next call.
+                    if (index->Sequence != 0) {
+                        _expired[_expiredIndex].Label = outbound->Label();
+                        _expired[_expiredIndex].Sequence = index->Sequence;
+                        _expiredIndex = (_expiredIndex + 1) % ExpiredSlots;
                     }
 
-                    _outbound.Release();
-                } else {
-                    ASSERT(_callback == nullptr);
+                    Free(*index);
+                    result = true;
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Abort all calls in flight, their callbacks are dispatched with the sequence of the call set to Aborted.
+            inline bool AbortOutbound()
+            {
+                bool result = false;
+
+                _lock.Lock();
+
+                // By index, the callback might register a new call.
+                for (uint32_t index = 0; index < _outbound.size(); index++) {
+                    if (_outbound[index].Call.IsValid() == true) {
+                        ProxyType<IIPC> handledObject(_outbound[index].Call);
+                        IDispatchType<IIPC>* callback(_outbound[index].Callback);
+
+                        Free(_outbound[index]);
+                        handledObject->Sequence(Aborted);
+                        callback->Dispatch(*handledObject);
+
+                        result = true;
+                    }
                 }
 
                 _lock.Unlock();
@@ -689,11 +993,54 @@ namespace Core {
                 return (result);
             }
 
+        private:
+            // Sequence 0 finds the call that went out without one.
+            inline OutboundList::iterator Find(const uint32_t sequence)
+            {
+                OutboundList::iterator index(_outbound.begin());
+
+                while ((index != _outbound.end()) && ((index->Call.IsValid() == false) || (index->Sequence != sequence))) {
+                    index++;
+                }
+
+                return (index);
+            }
+            inline bool Expired(const uint32_t label, const uint32_t sequence)
+            {
+                bool result = false;
+
+                if (sequence != 0) {
+                    for (IMessage::Identifier& entry : _expired) {
+                        if ((entry.Label == label) && (entry.Sequence == sequence)) {
+                            entry.Label = 0;
+                            result = true;
+                            break;
+                        }
+                    }
+                }
+
+                return (result);
+            }
+            inline void Free(Outbound& entry)
+            {
+                if (entry.Call.IsValid() == true) {
+                    entry.Sequence = 0;
+                    entry.Call.Release();
+                    entry.Callback = nullptr;
+                    _pending--;
+                }
+            }
+
         private:
             mutable CriticalSection _lock;
             Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            OutboundList _outbound;
+            uint32_t _pending;
+            uint32_t _sequence;
+            bool _pipelined;
+            IMessage::Identifier _expired[ExpiredSlots];
+            uint8_t _expiredIndex;
+            uint32_t _late;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
         };
@@ -730,6 +1077,10 @@ namespace Core {
         {
             _administration.AbortOutbound();
         }
+        inline uint32_t LateResponses() const
+        {
+            return (_administration.LateResponses());
+        }
         template <typename ACTUALELEMENT>
         inline uint32_t Invoke(ProxyType<ACTUALELEMENT>& command, IDispatchType<IIPC>* completed)
         {
@@ -771,6 +1122,50 @@ namespace Core {
         private:
             typedef LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&> BaseClass;
 
+            // Tells the other side we read sequences, an empty frame with the HANDSHAKE label.
+            class Handshake : public IMessage, public IReferenceCounted {
+            private:
+                Handshake(const Handshake&) = delete;
+                Handshake& operator=(const Handshake&) = delete;
+
+            public:
+                Handshake()
+                {
+                }
+                virtual ~Handshake()
+                {
+                }
+
+            public:
+                virtual uint32_t Label() const
+                {
+                    return (HANDSHAKE);
+                }
+                virtual uint32_t Sequence() const
+                {
+                    return (0);
+                }
+                virtual uint32_t Length() const
+                {
+                    return (0);
+                }
+                virtual uint16_t Serialize(uint8_t[], const uint16_t, const uint32_t) const
+                {
+                    return (0);
+                }
+                virtual uint16_t Deserialize(const uint8_t[], const uint16_t, const uint32_t)
+                {
+                    return (0);
+                }
+                virtual void AddRef() const
+                {
+                }
+                virtual uint32_t Release() const
+                {
+                    return (Core::ERROR_NONE);
+                }
+            };
+
             IPCLink() = delete;
             IPCLink(const IPCLink&) = delete;
             IPCLink& operator=(const IPCLink&) = delete;
@@ -780,6 +1175,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             template <typename ARG1>
@@ -787,6 +1183,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory, arg1)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             template <typename ARG1, typename ARG2>
@@ -794,6 +1191,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory, arg1, arg2)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             template <typename ARG1, typename ARG2, typename ARG3>
@@ -801,6 +1199,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory, arg1, arg2, arg3)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             template <typename ARG1, typename ARG2, typename ARG3, typename ARG4>
@@ -808,6 +1207,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory, arg1, arg2, arg3, arg4)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             template <typename ARG1, typename ARG2, typename ARG3, typename ARG4, typename ARG5>
@@ -815,6 +1215,7 @@ namespace Core {
                 : LinkType<ACTUALSOURCE, IMessage, IMessage, IPCFactory&>(2, *factory, arg1, arg2, arg3, arg4, arg5)
                 , _factory(*factory)
                 , _parent(*parent)
+                , _handshake()
             {
             }
             ~IPCLink()
@@ -855,6 +1256,9 @@ namespace Core {
                     // Whatever s hapening, Flush what we were doing..
                     _parent.Abort();
                     _factory.Flush();
+                } else {
+                    // First thing on the channel, so it is in before any of our frames with a sequence.
+                    BaseClass::Submit(ProxyType<IMessage>(&_handshake, &_handshake));
                 }
 
                 _parent.StateChange();
@@ -863,6 +1267,7 @@ namespace Core {
         private:
             IPCFactory& _factory;
             IPCChannelType<ACTUALSOURCE, EXTENSION>& _parent;
+            Handshake _handshake;
         };
 
         class IPCTrigger : public IDispatchType<IIPC> {
@@ -882,16 +1287,16 @@ namespace Core {
             }
 
         public:
-            uint32_t Wait(const uint32_t waitTime)
+            uint32_t Wait(const ProxyType<IIPC>& command, const uint32_t waitTime)
             {
                 uint32_t result = Core::ERROR_NONE;
 
                 // Now we wait for ever, to get a signal that we are done :-)
-                if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.AbortOutbound();
-
+                // If the call can not be withdrawn anymore, the signal was given while we gave up waiting.
+                if ((_signal.Lock(waitTime) != Core::ERROR_NONE) && (_administration.AbortOutbound(command) == true)) {
                     result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.AbortOutbound() == true) {
+                } else if (command->Sequence() == IPCFactory::Aborted) {
+                    // The call was aborted, the channel went down.
                     result = Core::ERROR_ASYNC_FAILED;
                 }
 
@@ -1041,13 +1446,19 @@ namespace Core {
         {
         }
 
+        // If the other side reads sequences, calls are tagged with one, so any number of them can be in flight
+        // on this channel. The responses are matched on that sequence, in whatever order they come in. If not,
+        // it is one call at a time.
         virtual uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed)
         {
             uint32_t success = Core::ERROR_UNAVAILABLE;
+            const bool pipelined = _administration.IsPipelined();
 
-            _serialize.Lock();
+            if (pipelined == false) {
+                _serialize.Lock();
+            }
 
-            if (_administration.InProgress() == true) {
+            if ((pipelined == false) && (_administration.InProgress() == true)) {
                 success = Core::ERROR_INPROGRESS;
             } else if (_link.IsOpen() == true) {
                 // We need to accept a CONST object to avoid an additional object creation
@@ -1060,15 +1471,20 @@ namespace Core {
                 success = Core::ERROR_NONE;
             }
 
-            _serialize.Unlock();
+            if (pipelined == false) {
+                _serialize.Unlock();
+            }
 
             return (success);
         }
         virtual uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime)
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
+            const bool pipelined = _administration.IsPipelined();
 
-            _serialize.Lock();
+            if (pipelined == false) {
+                _serialize.Lock();
+            }
 
             if (_link.IsOpen() == true) {
                 IPCTrigger sink(_administration);
@@ -1080,10 +1496,12 @@ namespace Core {
                 // Send out the
                 _link.Submit(command->IParameters());
 
-                success = sink.Wait(waitTime);
+                success = sink.Wait(command, waitTime);
             }
 
-            _serialize.Unlock();
+            if (pipelined == false) {
+                _serialize.Unlock();
+            }
 
             return (success);
         }
@@ -1,6 +1,17 @@
 #include "JSON.h"
+#include <atomic>
 #include <iomanip>
 #include <sstream>
+#include <typeinfo>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace WPEFramework {
 namespace Core {
@@ -19,8 +30,179 @@ namespace Core {
 
         /* static */ constexpr size_t Error::kContextMaxLength;
 
+        // SSE2 is part of x86-64 and NEON of AArch64, so there is nothing to detect at runtime; any
+        // other target uses the scalar loops, which also handle the tail of the vectorized ones.
+#if defined(__SSE2__) || defined(_M_X64)
+        static inline uint16_t FirstSet(const __m128i mask)
+        {
+            const uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+#ifdef __GNUC__
+            return (bits == 0 ? 16 : static_cast<uint16_t>(__builtin_ctz(bits)));
+#else
+            unsigned long index;
+            return (_BitScanForward(&index, bits) == 0 ? 16 : static_cast<uint16_t>(index));
+#endif
+        }
+#endif
+
+        uint16_t ScanWhiteSpace(const char stream[], const uint16_t length)
+        {
+            uint16_t index = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i tab = _mm_set1_epi8('\t');
+            const __m128i range = _mm_set1_epi8('\r' - '\t');
+
+            while ((length - index) >= 16) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(stream[index])));
+                // '\t', '\n', '\v', '\f' and '\r' are consecutive, check them as one unsigned range.
+                const __m128i control = _mm_sub_epi8(chunk, tab);
+                const __m128i white = _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(_mm_min_epu8(control, range), control));
+                const uint16_t found = FirstSet(_mm_xor_si128(white, _mm_set1_epi8(static_cast<char>(0xFF))));
+
+                index += found;
+
+                if (found != 16) {
+                    return (index);
+                }
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            const uint8x16_t space = vdupq_n_u8(' ');
+            const uint8x16_t tab = vdupq_n_u8('\t');
+            const uint8x16_t range = vdupq_n_u8('\r' - '\t');
+
+            while ((length - index) >= 16) {
+                const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&(stream[index])));
+                const uint8x16_t white = vorrq_u8(vceqq_u8(chunk, space), vcleq_u8(vsubq_u8(chunk, tab), range));
+
+                if (vminvq_u8(white) == 0) {
+                    break;
+                }
+                index += 16;
+            }
+#endif
+
+            while ((index < length) && ((stream[index] == ' ') || (static_cast<uint8_t>(stream[index] - '\t') <= static_cast<uint8_t>('\r' - '\t')))) {
+                index++;
+            }
+
+            return (index);
+        }
+
+        uint16_t ScanPlain(const char stream[], const uint16_t length)
+        {
+            uint16_t index = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+            const __m128i quote = _mm_set1_epi8('\"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i control = _mm_set1_epi8(0x1F);
+
+            while ((length - index) >= 16) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(stream[index])));
+                const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                    _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+                const uint16_t found = FirstSet(special);
+
+                index += found;
+
+                if (found != 16) {
+                    return (index);
+                }
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            const uint8x16_t quote = vdupq_n_u8('\"');
+            const uint8x16_t backslash = vdupq_n_u8('\\');
+            const uint8x16_t control = vdupq_n_u8(0x1F);
+
+            while ((length - index) >= 16) {
+                const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&(stream[index])));
+                const uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)), vcleq_u8(chunk, control));
+
+                if (vmaxvq_u8(special) != 0) {
+                    break;
+                }
+                index += 16;
+            }
+#endif
+
+            while ((index < length) && (stream[index] != '\"') && (stream[index] != '\\') && (static_cast<uint8_t>(stream[index]) > 0x1F)) {
+                index++;
+            }
+
+            return (index);
+        }
+
         /* static */ char IElement::NullTag[] = "null";
 
+        /* static */ constexpr uint16_t Container::Index::EMPTY;
+
+        Container::Index::Index(const JSONElementList& fields)
+            : _fields(static_cast<uint16_t>(fields.size()))
+            , _mask(1)
+            , _labels()
+            , _slots()
+        {
+            // Keep at least half of the slots free, so the probe sequences stay short.
+            while (_mask < (2u * _fields)) {
+                _mask <<= 1;
+            }
+
+            _slots.resize(_mask, std::pair<uint32_t, uint16_t>(0, EMPTY));
+            _mask -= 1;
+            _labels.reserve(_fields);
+
+            for (const JSONLabelValue& field : fields) {
+                _labels.emplace_back(field.first);
+
+                // Like the scan, the first field with a label wins.
+                if (Position(field.first) == EMPTY) {
+                    const uint32_t hash = Hash(field.first);
+                    uint32_t slot = hash & _mask;
+
+                    while (_slots[slot].second != EMPTY) {
+                        slot = (slot + 1) & _mask;
+                    }
+
+                    _slots[slot] = std::pair<uint32_t, uint16_t>(hash, static_cast<uint16_t>(_labels.size() - 1));
+                }
+            }
+        }
+
+        /* static */ const Container::Index* Container::Index::Instance(const Container& container, const JSONElementList& fields)
+        {
+            // Every container class gets its own slot, found on its type_info, without taking a lock. Once
+            // set, a slot is never released. If the library of a class is unloaded and another class ends up
+            // with the same type_info, it gets an index that does not match its labels, which is safe, as the
+            // positions found in an index are checked, but slow, as every lookup ends up in the scan.
+            static constexpr uint16_t Slots = 256;
+            static std::atomic<const std::type_info*> types[Slots];
+            static std::atomic<const Index*> indexes[Slots];
+
+            const std::type_info* type = &typeid(container);
+            uint16_t slot = static_cast<uint16_t>((reinterpret_cast<uintptr_t>(type) >> 4) % Slots);
+            const Index* result = nullptr;
+
+            for (uint16_t probes = 0; probes < Slots; probes++) {
+                const std::type_info* current = types[slot].load(std::memory_order_acquire);
+
+                if ((current == nullptr) && (types[slot].compare_exchange_strong(current, type, std::memory_order_acq_rel) == true)) {
+                    result = new Index(fields);
+                    indexes[slot].store(result, std::memory_order_release);
+                    break;
+                } else if (current == type) {
+                    // Might still be under construction by another thread, till then, the scan is used.
+                    result = indexes[slot].load(std::memory_order_acquire);
+                    break;
+                }
+
+                slot = (slot + 1) % Slots;
+            }
+
+            return (result);
+        }
+
         string Variant::GetDebugString(const TCHAR name[], int indent, int arrayIndex) const
         {
             std::stringstream ss;
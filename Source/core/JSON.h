@@ -1,6 +1,8 @@
 #ifndef __JSON_H
 #define __JSON_H
 
+#include <deque>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -64,6 +66,19 @@ namespace Core {
 
         string EXTERNAL ErrorDisplayMessage(const Error& err);
 
+        // Length of the run of whitespace (as in ::isspace) the stream starts with.
+        uint16_t EXTERNAL ScanWhiteSpace(const char stream[], const uint16_t length);
+
+        // Length of the run of characters the stream starts with that can be copied as is in, or out
+        // of, a quoted string: anything but a quote, a backslash or a control character.
+        uint16_t EXTERNAL ScanPlain(const char stream[], const uint16_t length);
+
+        inline uint16_t SkipWhiteSpace(const char stream[], const uint16_t length)
+        {
+            // Compact JSON has no whitespace at all, do not pay for a call in that case.
+            return (((length == 0) || (::isspace(stream[0]) == 0)) ? 0 : ScanWhiteSpace(stream, length));
+        }
+
         struct EXTERNAL IElement {
 
             static char NullTag[];
@@ -1344,8 +1359,13 @@ namespace Core {
                 ASSERT(maxLength > 0);
 
                 if ((quoted == false) || ((_scopeCount & NullBit) != 0)) {
-                    std::string source((_value.empty() || (_scopeCount & NullBit)) ? NullTag : _value);
-                    result = static_cast<uint16_t>(source.copy(stream, maxLength - result, offset));
+                    // Copy straight from the value, opaque values (e.g. JSON-RPC results) can be large.
+                    const bool null = (_value.empty() || ((_scopeCount & NullBit) != 0));
+                    const char* source = (null ? NullTag : _value.c_str());
+                    const size_t length = (null ? strlen(NullTag) : _value.length());
+
+                    result = static_cast<uint16_t>(std::min(length - offset, static_cast<size_t>(maxLength)));
+                    ::memcpy(stream, &(source[offset]), result);
                     offset = (result < maxLength ? 0 : offset + result);
                 } else {
                     if (offset == 0) {
@@ -1362,8 +1382,15 @@ namespace Core {
 
                         while ((result < maxLength) && (length > 0)) {
 
-                            // See where we are and add...
-                            if ((*source != '\"') || (_unaccountedCount == 1)) {
+                            // Whatever needs no escaping is copied in one go.
+                            const uint16_t plain = (_unaccountedCount == 1 ? 0 : ScanPlain(source, std::min(length, static_cast<uint16_t>(maxLength - result))));
+
+                            if (plain > 0) {
+                                ::memcpy(&(stream[result]), source, plain);
+                                result += plain;
+                                source += plain;
+                                length -= plain;
+                            } else if ((*source != '\"') || (_unaccountedCount == 1)) {
                                 _unaccountedCount = 0;
                                 stream[result++] = *source++;
                                 length--;
@@ -1485,6 +1512,14 @@ namespace Core {
 
                         // Move on to the next position
                         result++;
+
+                        // Inside a quoted string, take whatever needs no interpretation in one go.
+                        if ((escapedSequence == false) && ((_scopeCount & (ScopeMask | QuoteFoundBit)) == (QuoteFoundBit | 1))) {
+                            const uint16_t plain = ScanPlain(&(stream[result]), maxLength - result);
+
+                            _value.append(&(stream[result]), plain);
+                            result += plain;
+                        }
                     }
                 }
 
@@ -2169,7 +2204,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class ConstIteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef std::deque<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2266,7 +2301,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class IteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef std::deque<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2372,13 +2407,17 @@ namespace Core {
 
         public:
             ArrayType()
-                : _data()
+                : _state(0)
+                , _count(0)
+                , _data()
                 , _iterator(_data)
             {
             }
 
             ArrayType(const ArrayType<ELEMENT>& copy)
-                : _data(copy._data)
+                : _state(copy._state)
+                , _count(0)
+                , _data(copy._data)
                 , _iterator(_data)
             {
             }
@@ -2413,7 +2452,7 @@ namespace Core {
 
             inline ELEMENT& Add()
             {
-                _data.push_back(ELEMENT());
+                _data.emplace_back();
 
                 return (_data.back());
             }
@@ -2427,36 +2466,16 @@ namespace Core {
 
             ELEMENT& operator[](const uint32_t index)
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& operator[](const uint32_t index) const
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::const_iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& Get(const uint32_t index) const
@@ -2530,9 +2549,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == 0) {
-                    while ((loaded < maxLength) && ::isspace(stream[loaded])) {
-                        loaded++;
-                    }
+                    loaded += SkipWhiteSpace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -2561,9 +2578,7 @@ namespace Core {
                 while ((offset != 0) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER)) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += SkipWhiteSpace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -2588,7 +2603,7 @@ namespace Core {
                                     ++loaded;
                                 } else {
                                     offset = PARSE;
-                                    _data.push_back(ELEMENT());
+                                    _data.emplace_back();
                                 }
                                 break;
                             }
@@ -2652,14 +2667,18 @@ namespace Core {
                 uint16_t loaded = 0;
 
                 if (offset == 0) {
+                    // Anything else is no array, leave it, untouched, to the caller.
                     if (stream[0] == IMessagePack::NullValue) {
                         _state = UNDEFINED;
                         loaded = 1;
                     } else if ((stream[0] & 0xF0) == 0x90) {
                         _count = (stream[0] & 0x0F);
-                        offset = PARSE;
-                    } else if (stream[0] & 0xDC) {
+                        offset = (_count > 0 ? PARSE : 0);
+                        loaded = 1;
+                    } else if (stream[0] == 0xDC) {
+                        _count = 0;
                         offset = 1;
+                        loaded = 1;
                     }
                 }
 
@@ -2669,24 +2688,23 @@ namespace Core {
                         offset = 2;
                     } else if (offset == 2) {
                         _count = (_count << 8) | stream[loaded++];
-                        offset = PARSE;
+                        offset = (_count > 0 ? PARSE : 0);
                     }
                 }
 
                 while ((loaded < maxLength) && (offset >= PARSE)) {
 
                     if (offset == PARSE) {
-                        if (_count > 0) {
-                            _count--;
-                            _data.emplace_back(ELEMENT());
-                        } else {
-                            offset = 0;
-                        }
+                        _count--;
+                        _data.emplace_back();
                     }
-                    if (offset >= PARSE) {
-                        offset -= PARSE;
-                        loaded += static_cast<IMessagePack&>(_data.back()).Deserialize(stream, maxLength, offset);
-                        offset += PARSE;
+
+                    offset -= PARSE;
+                    loaded += static_cast<IMessagePack&>(_data.back()).Deserialize(&stream[loaded], maxLength - loaded, offset);
+                    offset += PARSE;
+
+                    if ((offset == PARSE) && (_count == 0)) {
+                        offset = 0;
                     }
                 }
 
@@ -2696,10 +2714,208 @@ namespace Core {
         private:
             uint8_t _state;
             uint16_t _count;
-            std::list<ELEMENT> _data;
+            std::deque<ELEMENT> _data;
             mutable IteratorType<ELEMENT> _iterator;
         };
 
+        // An array of which the elements are not kept, but produced one at a time while it is serialized,
+        // so a large response is never built as a tree of elements, only a single element is. The generator
+        // is called with the index of the element it should fill in and returns false if there is no such
+        // element. It runs once: what is written the first time is recorded and written again by a next
+        // serialization, e.g. the size of an HTTP body is determined before it is sent, so both agree, even
+        // if the source of the elements changed in between. MessagePack needs the number of elements upfront,
+        // so for that encoding all elements are packed before the first byte is written. Setting a generator,
+        // or clearing it, drops the recordings. It can not be deserialized.
+        template <typename ELEMENT>
+        class GeneratorType : public IElement, public IMessagePack {
+        private:
+            static constexpr uint16_t REPLAY = 1;
+            static constexpr uint16_t BEGIN_MARKER = 5;
+            static constexpr uint16_t PARSE = 9;
+
+        public:
+            typedef std::function<bool(const uint32_t index, ELEMENT& element)> Generator;
+
+            GeneratorType(const GeneratorType<ELEMENT>&) = delete;
+            GeneratorType<ELEMENT>& operator=(const GeneratorType<ELEMENT>&) = delete;
+
+            GeneratorType()
+                : _generator()
+                , _current()
+                , _index(0)
+                , _text()
+                , _packed()
+                , _recorded(false)
+                , _position(0)
+            {
+            }
+            explicit GeneratorType(const Generator& generator)
+                : _generator(generator)
+                , _current()
+                , _index(0)
+                , _text()
+                , _packed()
+                , _recorded(false)
+                , _position(0)
+            {
+            }
+            ~GeneratorType() override
+            {
+            }
+
+            GeneratorType<ELEMENT>& operator=(const Generator& generator)
+            {
+                _generator = generator;
+                Drop();
+
+                return (*this);
+            }
+
+        public:
+            // IElement and IMessagePack iface:
+            bool IsSet() const override
+            {
+                return (_generator != nullptr);
+            }
+
+            bool IsNull() const override
+            {
+                return (false);
+            }
+
+            void Clear() override
+            {
+                _generator = nullptr;
+                Drop();
+            }
+
+        private:
+            void Drop()
+            {
+                _text.clear();
+                _packed.clear();
+                _recorded = false;
+            }
+
+            bool Next() const
+            {
+                _current.Clear();
+
+                return ((_generator != nullptr) && (_generator(_index++, _current) == true));
+            }
+
+            template <typename TYPE>
+            static uint16_t Replay(TYPE stream[], const uint16_t maxLength, const TYPE recording[], const uint32_t length, uint32_t& position, uint16_t& offset)
+            {
+                const uint16_t loaded = static_cast<uint16_t>(std::min(static_cast<uint32_t>(maxLength), length - position));
+
+                ::memcpy(stream, &(recording[position]), loaded * sizeof(TYPE));
+                position += loaded;
+                offset = (position < length ? REPLAY : 0);
+
+                return (loaded);
+            }
+
+            // IElement iface:
+            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            {
+                uint16_t loaded = 0;
+
+                if ((offset == 0) && (_recorded == true)) {
+                    _position = 0;
+                    offset = REPLAY;
+                }
+
+                if (offset == REPLAY) {
+                    loaded = Replay(stream, maxLength, _text.c_str(), static_cast<uint32_t>(_text.length()), _position, offset);
+                } else {
+                    if (offset == 0) {
+                        _index = 0;
+                        _text.clear();
+                        stream[loaded++] = '[';
+                        offset = (Next() == false ? ~0 : PARSE);
+                    }
+                    while ((loaded < maxLength) && (offset != static_cast<uint16_t>(~0))) {
+                        if (offset >= PARSE) {
+                            offset -= PARSE;
+                            loaded += static_cast<const IElement&>(_current).Serialize(&(stream[loaded]), maxLength - loaded, offset);
+                            offset = (offset != 0 ? offset + PARSE : (Next() == true ? BEGIN_MARKER : ~0));
+                        } else if (offset == BEGIN_MARKER) {
+                            stream[loaded++] = ',';
+                            offset = PARSE;
+                        }
+                    }
+                    if ((offset == static_cast<uint16_t>(~0)) && (loaded < maxLength)) {
+                        stream[loaded++] = ']';
+                        offset = 0;
+                    }
+
+                    _text.append(stream, loaded);
+                    _recorded = (offset == 0);
+                }
+
+                return (loaded);
+            }
+
+            uint16_t Deserialize(const char[], const uint16_t, uint16_t& offset, Core::OptionalType<Error>& error) override
+            {
+                error = Error{ "A generated array can not be deserialized." };
+                offset = 0;
+
+                return (0);
+            }
+
+            // IMessagePack iface:
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            {
+                if (offset == 0) {
+                    if (_packed.empty() == true) {
+                        std::vector<uint8_t> element;
+                        uint16_t count = 0;
+
+                        // Room for the largest header, it is filled in once the number of elements is known.
+                        _packed.resize(3);
+                        _index = 0;
+
+                        while ((count < 0xFFFF) && (Next() == true)) {
+                            _current.IMessagePack::ToBuffer(element);
+                            _packed.insert(_packed.end(), element.begin(), element.end());
+                            count++;
+                        }
+
+                        if (count <= 15) {
+                            _packed.erase(_packed.begin(), _packed.begin() + 2);
+                            _packed[0] = (0x90 | static_cast<uint8_t>(count));
+                        } else {
+                            _packed[0] = 0xDC;
+                            _packed[1] = (count >> 8) & 0xFF;
+                            _packed[2] = count & 0xFF;
+                        }
+                    }
+
+                    _position = 0;
+                }
+
+                return (Replay(stream, maxLength, _packed.data(), static_cast<uint32_t>(_packed.size()), _position, offset));
+            }
+
+            uint16_t Deserialize(const uint8_t[], const uint16_t, uint16_t& offset) override
+            {
+                offset = 0;
+
+                return (0);
+            }
+
+        private:
+            Generator _generator;
+            mutable ELEMENT _current;
+            mutable uint32_t _index;
+            mutable string _text;
+            mutable std::vector<uint8_t> _packed;
+            mutable bool _recorded;
+            mutable uint32_t _position;
+        };
+
         class EXTERNAL Container : public IElement, public IMessagePack {
         private:
             enum modus : uint8_t {
@@ -2715,8 +2931,69 @@ namespace Core {
             static constexpr uint16_t SKIP_AFTER_KEY = 10;
             static constexpr uint16_t PARSE = 11;
 
+            // Below this number of fields, a scan over the labels is cheaper than a lookup in the index.
+            static constexpr uint16_t INDEX_THRESHOLD = 8;
+
             typedef std::pair<const TCHAR*, IElement*> JSONLabelValue;
-            typedef std::list<JSONLabelValue> JSONElementList;
+            typedef std::vector<JSONLabelValue> JSONElementList;
+
+            // Position of every label in the fields of a container class. It is built once, from the first
+            // instance that needs it, and shared by all instances of that class. Instances may deviate from
+            // the first one (fields added or removed later on), so a position found here is only a hint that
+            // is checked against the label of the instance itself.
+            class EXTERNAL Index {
+            private:
+                static constexpr uint16_t EMPTY = static_cast<uint16_t>(~0);
+
+            public:
+                Index() = delete;
+                Index(const Index& copy) = delete;
+                Index& operator=(const Index& RHS) = delete;
+
+                explicit Index(const JSONElementList& fields);
+                ~Index()
+                {
+                }
+
+                // The index of the class of the container, nullptr if it is not (yet) available.
+                static const Index* Instance(const Container& container, const JSONElementList& fields);
+
+            public:
+                inline uint16_t Fields() const
+                {
+                    return (_fields);
+                }
+                inline uint16_t Position(const TCHAR label[]) const
+                {
+                    const uint32_t hash = Hash(label);
+                    uint32_t slot = hash & _mask;
+
+                    while ((_slots[slot].second != EMPTY) && ((_slots[slot].first != hash) || (strcmp(label, _labels[_slots[slot].second].c_str()) != 0))) {
+                        slot = (slot + 1) & _mask;
+                    }
+
+                    return (_slots[slot].second);
+                }
+
+            private:
+                // FNV-1a
+                static uint32_t Hash(const TCHAR label[])
+                {
+                    uint32_t result = 2166136261;
+
+                    while (*label != '\0') {
+                        result = (result ^ static_cast<uint8_t>(*label++)) * 16777619;
+                    }
+
+                    return (result);
+                }
+
+            private:
+                uint16_t _fields;
+                uint32_t _mask;
+                std::vector<string> _labels;
+                std::vector<std::pair<uint32_t, uint16_t>> _slots;
+            };
 
             class Iterator {
             private:
@@ -2794,6 +3071,7 @@ namespace Core {
                 , _data()
                 , _iterator()
                 , _fieldName(true)
+                , _index(nullptr)
             {
             }
 
@@ -2841,6 +3119,8 @@ namespace Core {
                     index->second->Clear();
                     index++;
                 }
+
+                _state = 0;
             }
 
             void Add(const TCHAR label[], IElement* element)
@@ -2914,9 +3194,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == 0) {
-                    while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                        loaded++;
-                    }
+                    loaded += SkipWhiteSpace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -2946,9 +3224,7 @@ namespace Core {
                 while ((offset != 0) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER) || offset == SKIP_BEFORE_VALUE || offset == SKIP_AFTER_KEY) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += SkipWhiteSpace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -3188,15 +3464,30 @@ namespace Core {
             IElement* Find(const char label[])
             {
                 IElement* result = nullptr;
-
                 JSONElementList::iterator index = _data.begin();
 
-                while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
-                    index++;
+                if (_data.size() >= INDEX_THRESHOLD) {
+                    if (_index == nullptr) {
+                        _index = Index::Instance(*this, _data);
+                    }
+
+                    if ((_index != nullptr) && (_index->Fields() == _data.size())) {
+                        const uint16_t position = _index->Position(label);
+
+                        if ((position < _data.size()) && (strcmp(label, _data[position].first) == 0)) {
+                            result = _data[position].second;
+                        }
+                    }
                 }
 
-                if (index != _data.end()) {
-                    result = index->second;
+                if (result == nullptr) {
+                    while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
+                        index++;
+                    }
+
+                    if (index != _data.end()) {
+                        result = index->second;
+                    }
                 }
                 if (Request(label) == true) {
                     index = _data.end();
@@ -3250,6 +3541,7 @@ namespace Core {
             JSONElementList _data;
             mutable JSONElementList::const_iterator _iterator;
             mutable String _fieldName;
+            const Index* _index;
         };
 
         class VariantContainer;
@@ -89,6 +89,278 @@ namespace Core {
                 Core::JSON::String Data;
             };
 
+            typedef std::function<Core::ProxyType<Core::JSON::IElement>(const string& designator)> Resolver;
+
+            // An opaque JSON value (params or result). It is kept as text, unless a typed element is attached
+            // to it. An attached element is (de)serialized straight from/into the message stream, so the
+            // handler does not need to parse, or produce, an intermediate string.
+            class Payload : public Core::JSON::String {
+            private:
+                Payload(const Payload&) = delete;
+
+                // Follows a JSON value character by character, without storing it, to find where it ends.
+                class Skipper {
+                public:
+                    Skipper()
+                        : _depth(0)
+                        , _quoted(false)
+                        , _escaped(false)
+                        , _scalar(false)
+                    {
+                    }
+                    ~Skipper()
+                    {
+                    }
+
+                public:
+                    void Reset()
+                    {
+                        _depth = 0;
+                        _quoted = false;
+                        _escaped = false;
+                        _scalar = false;
+                    }
+                    // Returns what belongs to the value, the offset is 0 once its end has been found.
+                    uint16_t Skip(const char stream[], const uint16_t maxLength, uint16_t& offset)
+                    {
+                        uint16_t result = 0;
+                        bool finished = false;
+
+                        while ((result < maxLength) && (finished == false)) {
+                            const char current = stream[result];
+
+                            if (_quoted == true) {
+                                if (_escaped == true) {
+                                    _escaped = false;
+                                } else if (current == '\\') {
+                                    _escaped = true;
+                                } else if (current == '\"') {
+                                    _quoted = false;
+                                    finished = (_depth == 0);
+                                }
+                                result++;
+                            } else if ((current == '{') || (current == '[')) {
+                                _depth++;
+                                result++;
+                            } else if ((current == '}') || (current == ']')) {
+                                if (_depth == 0) {
+                                    // It belongs to whoever holds this value.
+                                    finished = true;
+                                } else {
+                                    _depth--;
+                                    finished = (_depth == 0);
+                                    result++;
+                                }
+                            } else if ((_depth == 0) && ((current == ',') || (current == ' ') || (current == '\t') || (current == '\n') || (current == '\r') || (current == '\0'))) {
+                                finished = _scalar;
+                                result += (_scalar == true ? 0 : 1);
+                            } else {
+                                _quoted = (current == '\"');
+                                _scalar = (_depth == 0);
+                                result++;
+                            }
+                        }
+
+                        offset = (finished == true ? 0 : 1);
+
+                        return (result);
+                    }
+
+                private:
+                    uint16_t _depth;
+                    bool _quoted;
+                    bool _escaped;
+                    bool _scalar;
+                };
+
+            public:
+                Payload()
+                    : Core::JSON::String(false)
+                    , _parent(nullptr)
+                    , _element()
+                    , _skipper()
+                    , _mismatched(false)
+                {
+                }
+                explicit Payload(const Message* parent)
+                    : Core::JSON::String(false)
+                    , _parent(parent)
+                    , _element()
+                    , _skipper()
+                    , _mismatched(false)
+                {
+                }
+                ~Payload() override
+                {
+                }
+
+                using Core::JSON::String::operator=;
+
+                Payload& operator=(const string& RHS)
+                {
+                    if (_element.IsValid() == true) {
+                        _element.Release();
+                    }
+                    Core::JSON::String::operator=(RHS);
+                    return (*this);
+                }
+                Payload& operator=(const Payload& RHS)
+                {
+                    Core::JSON::String::operator=(RHS);
+                    _element = RHS._element;
+                    return (*this);
+                }
+
+            public:
+                inline bool IsAttached() const
+                {
+                    return (_element.IsValid());
+                }
+                inline const Core::ProxyType<Core::JSON::IElement>& Element() const
+                {
+                    return (_element);
+                }
+                inline void Attach(const Core::ProxyType<Core::JSON::IElement>& element)
+                {
+                    _element = element;
+                }
+                // The parameters were there, but they did not fit the typed object of the method.
+                inline bool IsMismatched() const
+                {
+                    return (_mismatched);
+                }
+                // No value, or a null value.
+                inline bool IsEmpty() const
+                {
+                    return (_element.IsValid() == true ? _element->IsNull() : Core::JSON::String::Value().empty());
+                }
+                const string Value() const
+                {
+                    string result;
+
+                    if (_element.IsValid() == false) {
+                        result = Core::JSON::String::Value();
+                    } else {
+                        _element->ToString(result);
+                    }
+
+                    return (result);
+                }
+
+                // IElement and IMessagePack iface:
+                bool IsSet() const override
+                {
+                    return ((_element.IsValid() == true) || (Core::JSON::String::IsSet() == true));
+                }
+                bool IsNull() const override
+                {
+                    return (_element.IsValid() == true ? _element->IsNull() : Core::JSON::String::IsNull());
+                }
+                void Clear() override
+                {
+                    if (_element.IsValid() == true) {
+                        _element.Release();
+                    }
+                    _mismatched = false;
+                    Core::JSON::String::Clear();
+                }
+
+            protected:
+                uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+                {
+                    return (_element.IsValid() == true ? _element->Serialize(stream, maxLength, offset) : Core::JSON::String::Serialize(stream, maxLength, offset));
+                }
+                uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Core::JSON::Error>& error) override
+                {
+                    uint16_t loaded;
+
+                    if (offset == 0) {
+                        Resolve();
+                    }
+
+                    if (_mismatched == true) {
+                        loaded = _skipper.Skip(stream, maxLength, offset);
+                    } else if (_element.IsValid() == false) {
+                        loaded = Core::JSON::String::Deserialize(stream, maxLength, offset, error);
+                    } else {
+                        // The value is followed along, so if it turns out not to fit the typed element, the rest
+                        // of it can be skipped. The request is still handled, and answered with invalid params.
+                        uint16_t skipped = offset;
+                        const uint16_t length = _skipper.Skip(stream, maxLength, skipped);
+                        Core::OptionalType<Core::JSON::Error> typed;
+
+                        loaded = _element->Deserialize(stream, maxLength, offset, typed);
+
+                        // Also if the element is done, while the value is not, it did not take it.
+                        if ((typed.IsSet() == true) || ((offset == 0) && ((skipped != 0) || (loaded != length)))) {
+                            _element.Release();
+                            _mismatched = true;
+                            loaded = length;
+                            offset = skipped;
+                        }
+                    }
+
+                    return (loaded);
+                }
+                uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+                {
+                    uint16_t loaded;
+
+                    if (_element.IsValid() == false) {
+                        loaded = Core::JSON::String::Serialize(stream, maxLength, offset);
+                    } else {
+                        const Core::JSON::IMessagePack* element = dynamic_cast<const Core::JSON::IMessagePack*>(_element.operator->());
+
+                        ASSERT(element != nullptr);
+
+                        loaded = element->Serialize(stream, maxLength, offset);
+                    }
+
+                    return (loaded);
+                }
+                uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+                {
+                    uint16_t loaded;
+
+                    if (offset == 0) {
+                        Resolve();
+                    }
+
+                    Core::JSON::IMessagePack* element = (_element.IsValid() == true ? dynamic_cast<Core::JSON::IMessagePack*>(_element.operator->()) : nullptr);
+
+                    if (element != nullptr) {
+                        loaded = element->Deserialize(stream, maxLength, offset);
+                    } else {
+                        loaded = Core::JSON::String::Deserialize(stream, maxLength, offset);
+                    }
+
+                    return (loaded);
+                }
+
+            private:
+                // The designator precedes the parameters in practically every request. If it did not, or
+                // nobody is interested in a typed object, the parameters are kept as text.
+                void Resolve()
+                {
+                    if (_element.IsValid() == true) {
+                        _element.Release();
+                    }
+
+                    _skipper.Reset();
+                    _mismatched = false;
+
+                    if ((_parent != nullptr) && (_parent->_resolver) && (_parent->Designator.IsSet() == true)) {
+                        _element = _parent->_resolver(_parent->Designator.Value());
+                    }
+                }
+
+            private:
+                const Message* _parent;
+                Core::ProxyType<Core::JSON::IElement> _element;
+                Skipper _skipper;
+                bool _mismatched;
+            };
+
         public:
             static constexpr TCHAR DefaultVersion[] = _T("2.0");
 
@@ -97,9 +369,10 @@ namespace Core {
                 , JSONRPC(DefaultVersion)
                 , Id(~0)
                 , Designator()
-                , Parameters(false)
-                , Result(false)
+                , Parameters(this)
+                , Result()
                 , Error()
+                , _resolver()
             {
                 Add(_T("jsonrpc"), &JSONRPC);
                 Add(_T("id"), &Id);
@@ -134,12 +407,21 @@ namespace Core {
                 size_t pos = designator.find_last_of('.', designator.find_last_of('@'));
                 return (pos == string::npos ? EMPTY_STRING : designator.substr(0, pos));
             }
-            static string Method(const string& designator)
+            static void Method(const string& designator, size_t& offset, size_t& length)
             {
                 size_t end = designator.find_last_of('@');
                 size_t begin = designator.find_last_of('.', end);
 
-                return (designator.substr((begin == string::npos) ? 0 : begin + 1, (end == string::npos ? string::npos : (begin == string::npos) ? end : end - begin - 1)));
+                offset = (begin == string::npos ? 0 : begin + 1);
+                length = (end == string::npos ? designator.length() : end) - offset;
+            }
+            static string Method(const string& designator)
+            {
+                size_t offset, length;
+
+                Method(designator, offset, length);
+
+                return (designator.substr(offset, length));
             }
             static string FullMethod(const string& designator)
             {
@@ -198,6 +480,13 @@ namespace Core {
                 Parameters.Clear();
                 Result.Clear();
                 Error.Clear();
+                _resolver = nullptr;
+            }
+            // Whoever is about to deserialize a request into this message can offer the typed parameter
+            // object of the method it is destined for. It is only used for the next deserialization.
+            void Resolve(const Resolver& resolver)
+            {
+                _resolver = resolver;
             }
             string Callsign() const
             {
@@ -230,9 +519,12 @@ namespace Core {
             Core::JSON::String JSONRPC;
             Core::JSON::DecUInt32 Id;
             Core::JSON::String Designator;
-            Core::JSON::String Parameters;
-            Core::JSON::String Result;
+            Payload Parameters;
+            Payload Result;
             Info Error;
+
+        private:
+            Resolver _resolver;
         };
 
         class EXTERNAL Connection {
@@ -279,6 +571,8 @@ namespace Core {
 
         typedef std::function<void(const Connection& channel, const string& parameters)> CallbackFunction;
         typedef std::function<uint32_t(const string& method, const string& parameters, string& result)> InvokeFunction;
+        typedef std::function<uint32_t(const string& method, const Message::Payload& parameters, Message::Payload& result)> PayloadFunction;
+        typedef std::function<Core::ProxyType<Core::JSON::IElement>()> ParameterFactory;
 
         class EXTERNAL Handler {
         private:
@@ -287,13 +581,21 @@ namespace Core {
                 Entry() = delete;
                 Entry& operator=(const Entry&) = delete;
 
+                enum kind : uint8_t {
+                    ASYNCHRONOUS,
+                    SYNCHRONOUS,
+                    TYPED
+                };
+
                 union Functions {
-                    Functions(const Functions& function, const bool async)
+                    Functions(const Functions& function, const kind type)
                     {
-                        if (async == true) {
+                        if (type == ASYNCHRONOUS) {
                             new (&_callback) auto(function._callback);
-                        } else {
+                        } else if (type == SYNCHRONOUS) {
                             new (&_invoke) auto(function._invoke);
+                        } else {
+                            new (&_payload) auto(function._payload);
                         }
                     }
                     Functions(const CallbackFunction& function)
@@ -304,54 +606,262 @@ namespace Core {
                         : _invoke(function)
                     {
                     }
+                    Functions(const PayloadFunction& function)
+                        : _payload(function)
+                    {
+                    }
                     ~Functions()
                     {
                     }
 
                     CallbackFunction _callback;
                     InvokeFunction _invoke;
+                    PayloadFunction _payload;
                 };
 
             public:
-                Entry(const CallbackFunction& callback)
-                    : _asynchronous(true)
+                Entry(const string& name, const CallbackFunction& callback)
+                    : _name(name)
+                    , _type(ASYNCHRONOUS)
+                    , _info(callback)
+                    , _parameters()
+                {
+                }
+                Entry(const string& name, const InvokeFunction& callback)
+                    : _name(name)
+                    , _type(SYNCHRONOUS)
                     , _info(callback)
+                    , _parameters()
                 {
                 }
-                Entry(const InvokeFunction& callback)
-                    : _asynchronous(false)
+                Entry(const string& name, const PayloadFunction& callback, const ParameterFactory& parameters)
+                    : _name(name)
+                    , _type(TYPED)
                     , _info(callback)
+                    , _parameters(parameters)
                 {
                 }
                 Entry(const Entry& copy)
-                    : _asynchronous(copy._asynchronous)
-                    , _info(copy._info, copy._asynchronous)
+                    : _name(copy._name)
+                    , _type(copy._type)
+                    , _info(copy._info, copy._type)
+                    , _parameters(copy._parameters)
                 {
                 }
                 ~Entry()
                 {
-                    if (_asynchronous == true) {
+                    if (_type == ASYNCHRONOUS) {
                         _info._callback.~CallbackFunction();
-                    } else {
+                    } else if (_type == SYNCHRONOUS) {
                         _info._invoke.~InvokeFunction();
+                    } else {
+                        _info._payload.~PayloadFunction();
                     }
                 }
 
             public:
+                const string& Name() const
+                {
+                    return (_name);
+                }
+                // The typed object the parameters of this method can be deserialized in, if it has one.
+                Core::ProxyType<Core::JSON::IElement> Parameters() const
+                {
+                    return (_parameters ? _parameters() : Core::ProxyType<Core::JSON::IElement>());
+                }
                 uint32_t Invoke(const Connection connection, const string& method, const string& parameters, string& response)
                 {
                     uint32_t result = ~0;
-                    if (_asynchronous == true) {
+
+                    if (_type == ASYNCHRONOUS) {
                         _info._callback(connection, parameters);
-                    } else {
+                    } else if (_type == SYNCHRONOUS) {
                         result = _info._invoke(method, parameters, response);
+                    } else {
+                        Message::Payload inbound;
+                        Message::Payload outbound;
+
+                        if (parameters.empty() == false) {
+                            inbound = parameters;
+                        }
+
+                        result = _info._payload(method, inbound, outbound);
+                        response = outbound.Value();
+                    }
+
+                    return (result);
+                }
+                uint32_t Invoke(const Connection connection, const string& method, const Message::Payload& parameters, Message::Payload& response)
+                {
+                    uint32_t result = ~0;
+
+                    if (_type == ASYNCHRONOUS) {
+                        _info._callback(connection, parameters.Value());
+                    } else if (_type == SYNCHRONOUS) {
+                        string outbound;
+
+                        result = _info._invoke(method, parameters.Value(), outbound);
+                        response = outbound;
+                    } else {
+                        result = _info._payload(method, parameters, response);
                     }
+
                     return (result);
                 }
 
             private:
-                bool _asynchronous;
+                const string _name;
+                kind _type;
                 Functions _info;
+                ParameterFactory _parameters;
+            };
+
+            // Typed view on the parameters of a call: the element that was attached while the request was
+            // deserialized, or, if there is none, one parsed from the text of the parameters.
+            template <typename TYPE>
+            class Inbound {
+            private:
+                Inbound() = delete;
+                Inbound(const Inbound<TYPE>&) = delete;
+                Inbound<TYPE>& operator=(const Inbound<TYPE>&) = delete;
+
+            public:
+                explicit Inbound(const Message::Payload& parameters)
+                    : _local()
+                    , _element(parameters.IsAttached() == true ? dynamic_cast<const TYPE*>(parameters.Element().operator->()) : nullptr)
+                {
+                    if (_element == nullptr) {
+                        _local.FromString(parameters.Value());
+                        _element = &_local;
+                    }
+                }
+                ~Inbound()
+                {
+                }
+
+            public:
+                inline const TYPE& operator*() const
+                {
+                    return (*_element);
+                }
+
+            private:
+                TYPE _local;
+                const TYPE* _element;
+            };
+
+            // The dispatch table is a flat list of entries, sorted on method name, built when methods are
+            // (un)registered. A lookup is a binary search on a slice of the designator, so no key string
+            // has to be constructed to find the method for an incoming request.
+            class Table {
+            private:
+                Table& operator=(const Table&) = delete;
+
+                typedef std::list<Entry> EntryList;
+                typedef std::vector<Entry*> EntryIndex;
+
+            public:
+                Table()
+                    : _entries()
+                    , _index()
+                {
+                }
+                Table(const Table& copy)
+                    : _entries(copy._entries)
+                    , _index()
+                {
+                    for (Entry& entry : _entries) {
+                        _index.push_back(&entry);
+                    }
+                }
+                ~Table()
+                {
+                }
+
+            public:
+                inline uint16_t Count() const
+                {
+                    return (static_cast<uint16_t>(_index.size()));
+                }
+                inline const Entry& operator[](const uint16_t index) const
+                {
+                    ASSERT(index < _index.size());
+                    return (*(_index[index]));
+                }
+                Entry* Find(const string& name) const
+                {
+                    return (Find(name, 0, name.length()));
+                }
+                Entry* Find(const string& source, const size_t offset, const size_t length) const
+                {
+                    Entry* result = nullptr;
+                    EntryIndex::const_iterator index = LowerBound(source, offset, length);
+
+                    if ((index != _index.end()) && ((*index)->Name().compare(0, string::npos, source, offset, length) == 0)) {
+                        result = *index;
+                    }
+
+                    return (result);
+                }
+                template <typename... ARGUMENTS>
+                bool Insert(const string& name, ARGUMENTS&&... arguments)
+                {
+                    bool inserted = false;
+                    EntryIndex::const_iterator index = LowerBound(name, 0, name.length());
+
+                    if ((index == _index.end()) || ((*index)->Name() != name)) {
+                        _entries.emplace_back(name, std::forward<ARGUMENTS>(arguments)...);
+                        _index.insert(index, &(_entries.back()));
+                        inserted = true;
+                    }
+
+                    return (inserted);
+                }
+                bool Insert(const Entry& entry)
+                {
+                    bool inserted = false;
+                    EntryIndex::const_iterator index = LowerBound(entry.Name(), 0, entry.Name().length());
+
+                    if ((index == _index.end()) || ((*index)->Name() != entry.Name())) {
+                        _entries.push_back(entry);
+                        _index.insert(index, &(_entries.back()));
+                        inserted = true;
+                    }
+
+                    return (inserted);
+                }
+                bool Remove(const string& name)
+                {
+                    bool removed = false;
+                    EntryIndex::const_iterator index = LowerBound(name, 0, name.length());
+
+                    if ((index != _index.end()) && ((*index)->Name() == name)) {
+                        const Entry* entry = *index;
+                        EntryList::iterator loop = _entries.begin();
+
+                        while (&(*loop) != entry) {
+                            loop++;
+                        }
+
+                        _index.erase(index);
+                        _entries.erase(loop);
+                        removed = true;
+                    }
+
+                    return (removed);
+                }
+
+            private:
+                EntryIndex::const_iterator LowerBound(const string& source, const size_t offset, const size_t length) const
+                {
+                    return (std::lower_bound(_index.begin(), _index.end(), nullptr, [&source, offset, length](const Entry* element, const void*) -> bool {
+                        return (element->Name().compare(0, string::npos, source, offset, length) < 0);
+                    }));
+                }
+
+            private:
+                EntryList _entries;
+                EntryIndex _index;
             };
 
             class Observer {
@@ -392,7 +902,6 @@ namespace Core {
                 string _designator;
             };
 
-            typedef std::map<const string, Entry> HandlerMap;
             typedef std::list<Observer> ObserverList;
             typedef std::map<string, ObserverList> ObserverMap;
 
@@ -403,19 +912,16 @@ namespace Core {
             public:
                 EventIterator()
                     : _container(nullptr)
-                    , _index()
                     , _position(~0)
                 {
                 }
-                EventIterator(const HandlerMap& container)
+                EventIterator(const Table& container)
                     : _container(&container)
-                    , _index()
                     , _position(~0)
                 {
                 }
                 EventIterator(const EventIterator& copy)
                     : _container(copy._container)
-                    , _index(copy._index)
                     , _position(copy._position)
                 {
                 }
@@ -426,7 +932,6 @@ namespace Core {
                 EventIterator& operator=(const EventIterator& rhs)
                 {
                     _container = rhs._container;
-                    _index = rhs._index;
                     _position = rhs._position;
 
                     return (*this);
@@ -435,7 +940,7 @@ namespace Core {
             public:
                 bool IsValid() const
                 {
-                    return ((_container != nullptr) && (_position < _container->size()));
+                    return ((_container != nullptr) && (_position < _container->Count()));
                 }
                 void Reset()
                 {
@@ -446,10 +951,8 @@ namespace Core {
                     if (_position == static_cast<uint16_t>(~0)) {
                         if (_container != nullptr) {
                             _position = 0;
-                            _index = _container->cbegin();
                         }
-                    } else if (_index != _container->cend()) {
-                        _index++;
+                    } else if (_position < _container->Count()) {
                         _position++;
                     }
                     return (IsValid());
@@ -457,12 +960,11 @@ namespace Core {
                 const string& Event() const
                 {
                     ASSERT(IsValid());
-                    return (_index->first);
+                    return ((*_container)[_position].Name());
                 }
 
             private:
-                const HandlerMap* _container;
-                HandlerMap::const_iterator _index;
+                const Table* _container;
                 uint16_t _position;
             };
 
@@ -500,15 +1002,11 @@ namespace Core {
             {
                 bool copied = false;
 
-                HandlerMap::const_iterator index = copy._handlers.find(method);
+                const Entry* info = copy._handlers.Find(method);
 
-                if (index != copy._handlers.end()) {
+                if (info != nullptr) {
                     copied = true;
-                    const Entry& info(index->second);
-
-                    _handlers.emplace(std::piecewise_construct,
-                        std::forward_as_tuple(method),
-                        std::forward_as_tuple(info));
+                    _handlers.Insert(*info);
                 }
 
                 return (copied);
@@ -517,7 +1015,12 @@ namespace Core {
             // The interface is prepared.
             inline uint32_t Exists(const string& methodName) const
             {
-                return ((_handlers.find(methodName) != _handlers.end()) ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
+                return ((_handlers.Find(methodName) != nullptr) ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
+            }
+            // Same as above, but for the method that is part of the given designator.
+            inline uint32_t Exists(const string& designator, const size_t offset, const size_t length) const
+            {
+                return ((_handlers.Find(designator, offset, length) != nullptr) ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
             }
             bool HasVersionSupport(const uint8_t number) const
             {
@@ -597,38 +1100,74 @@ namespace Core {
                 // Due to versioning, we do allow to overwrite methods that have been registered.
                 // These are typically methods that are different from the preferred interface..
 
-                _handlers.emplace(std::piecewise_construct,
-                    std::make_tuple(methodName),
-                    std::make_tuple(lambda));
+                _handlers.Insert(methodName, lambda);
             }
             void Register(const string& methodName, const CallbackFunction& lambda)
             {
                 // Due to versioning, we do allow to overwrite methods that have been registsred.
                 // These are typically methods that are different from the preferred interface..
 
-                _handlers.emplace(std::piecewise_construct,
-                    std::make_tuple(methodName),
-                    std::make_tuple(lambda));
+                _handlers.Insert(methodName, lambda);
+            }
+            void Register(const string& methodName, const PayloadFunction& lambda, const ParameterFactory& parameters)
+            {
+                _handlers.Insert(methodName, lambda, parameters);
             }
             void Unregister(const string& methodName)
             {
-                HandlerMap::iterator index = _handlers.find(methodName);
-
-                ASSERT((index != _handlers.end()) && _T("Do not unregister methods that are not registered!!!"));
+                bool removed VARIABLE_IS_NOT_USED = _handlers.Remove(methodName);
 
-                if (index != _handlers.end()) {
-                    _handlers.erase(index);
-                }
+                ASSERT((removed == true) && _T("Do not unregister methods that are not registered!!!"));
             }
+            // The method is handed to the handler as is (e.g. the FullMethod() of a message), only the part
+            // without the callsign, version and index is used to find the handler.
             uint32_t Invoke(const Connection connection, const string& method, const string& parameters, string& response)
             {
                 uint32_t result = Core::ERROR_UNKNOWN_KEY;
+                size_t offset, length;
 
                 response.clear();
 
-                HandlerMap::iterator index = _handlers.find(Message::Method(method));
-                if (index != _handlers.end()) {
-                    result = index->second.Invoke(connection, method, parameters, response);
+                Message::Method(method, offset, length);
+
+                Entry* entry = _handlers.Find(method, offset, length);
+                if (entry != nullptr) {
+                    result = entry->Invoke(connection, method, parameters, response);
+                }
+                return (result);
+            }
+            // Same as above, but the parameters are taken from, and the result is attached to, the message
+            // payloads, so typed handlers do not go through an intermediate string.
+            uint32_t Invoke(const Connection connection, const string& method, const Message::Payload& parameters, Message::Payload& response)
+            {
+                uint32_t result = Core::ERROR_UNKNOWN_KEY;
+                size_t offset, length;
+
+                response.Clear();
+
+                Message::Method(method, offset, length);
+
+                Entry* entry = _handlers.Find(method, offset, length);
+                if (entry != nullptr) {
+                    if (parameters.IsMismatched() == true) {
+                        result = Core::ERROR_INVALID_SIGNATURE;
+                    } else {
+                        result = entry->Invoke(connection, method, parameters, response);
+                    }
+                }
+                return (result);
+            }
+            // The typed object the parameters of the method in the designator can be deserialized in, if any.
+            Core::ProxyType<Core::JSON::IElement> Parameters(const string& designator) const
+            {
+                Core::ProxyType<Core::JSON::IElement> result;
+                size_t offset, length;
+
+                Message::Method(designator, offset, length);
+
+                const Entry* entry = _handlers.Find(designator, offset, length);
+                if (entry != nullptr) {
+                    result = entry->Parameters();
                 }
                 return (result);
             }
@@ -736,41 +1275,178 @@ namespace Core {
             }
 
         private:
+            // Typed parameters and results are recycled, so once it is warmed up, a call neither allocates them
+            // nor the strings in them. Every registration holds the recycler of its types, and so does every
+            // element that is out, so a recycler goes with the last of them, e.g. a result that is still being
+            // sent when its method is unregistered. A recycler keeps at most Capacity elements, the ones
+            // returned when it is full are deleted. Variants are created for every call, as the fields of a
+            // variant are what was deserialized in it before.
+            template <typename TYPE>
+            class RecyclerType {
+            private:
+                static constexpr uint8_t Capacity = 4;
+
+                class Recycled : public Core::ProxyObject<TYPE> {
+                private:
+                    Recycled() = delete;
+                    Recycled(const Recycled&) = delete;
+                    Recycled& operator=(const Recycled&) = delete;
+
+                public:
+                    explicit Recycled(const Core::ProxyType<RecyclerType<TYPE>>& recycler)
+                        : Core::ProxyObject<TYPE>()
+                        , _recycler(recycler)
+                    {
+                    }
+                    ~Recycled() override
+                    {
+                    }
+
+                public:
+                    void Lease(const Core::ProxyType<RecyclerType<TYPE>>& recycler)
+                    {
+                        _recycler = recycler;
+                    }
+                    uint32_t Release() const override
+                    {
+                        uint32_t result = Core::ERROR_NONE;
+
+                        if (Core::InterlockedDecrement(Core::ProxyService<TYPE>::m_RefCount) == 0) {
+                            // Once it is back, the element no longer holds on to its recycler.
+                            Core::ProxyType<RecyclerType<TYPE>> recycler(_recycler);
+                            _recycler = Core::ProxyType<RecyclerType<TYPE>>();
+
+                            if (recycler->Return(const_cast<Recycled*>(this)) == false) {
+                                delete this;
+                            }
+
+                            result = Core::ERROR_DESTRUCTION_SUCCEEDED;
+                        }
+
+                        return (result);
+                    }
+
+                private:
+                    mutable Core::ProxyType<RecyclerType<TYPE>> _recycler;
+                };
+
+            public:
+                RecyclerType(const RecyclerType<TYPE>&) = delete;
+                RecyclerType<TYPE>& operator=(const RecyclerType<TYPE>&) = delete;
+
+                RecyclerType()
+                    : _lock()
+                    , _elements()
+                {
+                }
+                ~RecyclerType()
+                {
+                    for (Recycled* element : _elements) {
+                        delete element;
+                    }
+                }
+
+            public:
+                static Core::ProxyType<RecyclerType<TYPE>> Create()
+                {
+                    return (Core::ProxyType<RecyclerType<TYPE>>::Create());
+                }
+                static Core::ProxyType<TYPE> Element(const Core::ProxyType<RecyclerType<TYPE>>& recycler)
+                {
+                    return (Element(recycler, ::TemplateIntToType<std::is_base_of<Core::JSON::VariantContainer, TYPE>::value>()));
+                }
+
+            private:
+                static Core::ProxyType<TYPE> Element(const Core::ProxyType<RecyclerType<TYPE>>& recycler, const ::TemplateIntToType<false>&)
+                {
+                    Recycled* element = nullptr;
+
+                    recycler->_lock.Lock();
+
+                    if (recycler->_elements.empty() == false) {
+                        element = recycler->_elements.back();
+                        recycler->_elements.pop_back();
+                    }
+
+                    recycler->_lock.Unlock();
+
+                    if (element == nullptr) {
+                        element = new (0) Recycled(recycler);
+                    } else {
+                        element->Lease(recycler);
+                        element->Clear();
+                    }
+
+                    return (Core::ProxyType<TYPE>(static_cast<Core::ProxyObject<TYPE>&>(*element)));
+                }
+                static Core::ProxyType<TYPE> Element(const Core::ProxyType<RecyclerType<TYPE>>&, const ::TemplateIntToType<true>&)
+                {
+                    return (Core::ProxyType<TYPE>::Create());
+                }
+                bool Return(Recycled* element)
+                {
+                    bool kept = false;
+
+                    _lock.Lock();
+
+                    if (_elements.size() < Capacity) {
+                        _elements.push_back(element);
+                        kept = true;
+                    }
+
+                    _lock.Unlock();
+
+                    return (kept);
+                }
+
+            private:
+                Core::CriticalSection _lock;
+                std::vector<Recycled*> _elements;
+            };
+
+            template <typename TYPE>
+            static ParameterFactory Factory(const Core::ProxyType<RecyclerType<TYPE>>& recycler)
+            {
+                return ([recycler]() -> Core::ProxyType<Core::JSON::IElement> {
+                    return (Core::ProxyType<Core::JSON::IElement>(RecyclerType<TYPE>::Element(recycler)));
+                });
+            }
             template <typename PARAMETER, typename GET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, const GET_METHOD& getMethod, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const REALOBJECT&, PARAMETER&)> getter = getMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter](const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, getter, recycler](const string&, const Message::Payload& inbound, Message::Payload& outbound) -> uint32_t {
                     uint32_t code;
-                    if (inbound.empty() == false) {
+                    if (inbound.IsEmpty() == false) {
                         code = Core::ERROR_UNAVAILABLE;
                     } else {
-                        code = getter(*objectPtr, parameter);
-                        parameter.ToString(outbound);
+                        Core::ProxyType<PARAMETER> parameter(RecyclerType<PARAMETER>::Element(recycler));
+                        code = getter(*objectPtr, *parameter);
+                        outbound.Attach(Core::ProxyType<Core::JSON::IElement>(parameter));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, ParameterFactory());
             }
             template <typename PARAMETER, typename SET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, REALOBJECT* objectPtr, const SET_METHOD& setMethod)
             {
                 std::function<uint32_t(REALOBJECT&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, setter](const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, setter](const string&, const Message::Payload& inbound, Message::Payload&) -> uint32_t {
                     uint32_t code;
-                    if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
-                        code = setter(*objectPtr, parameter);
+                    if (inbound.IsEmpty() == false) {
+                        Inbound<PARAMETER> parameter(inbound);
+                        code = setter(*objectPtr, *parameter);
                     } else {
                         code = Core::ERROR_UNAVAILABLE;
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<PARAMETER>(recycler));
             }
             template <typename PARAMETER, typename GET_METHOD, typename SET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, const GET_METHOD& getMethod, const SET_METHOD& setMethod, REALOBJECT* objectPtr)
@@ -778,57 +1454,59 @@ namespace Core {
                 std::function<uint32_t(const REALOBJECT&, PARAMETER&)> getter = getMethod;
                 std::function<uint32_t(REALOBJECT&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter, setter](const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, getter, setter, recycler](const string&, const Message::Payload& inbound, Message::Payload& outbound) -> uint32_t {
                     uint32_t code;
-                    if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
-                        code = setter(*objectPtr, parameter);
+                    if (inbound.IsEmpty() == false) {
+                        Inbound<PARAMETER> parameter(inbound);
+                        code = setter(*objectPtr, *parameter);
                     } else {
-                        code = getter(*objectPtr, parameter);
-                        parameter.ToString(outbound);
+                        Core::ProxyType<PARAMETER> parameter(RecyclerType<PARAMETER>::Element(recycler));
+                        code = getter(*objectPtr, *parameter);
+                        outbound.Attach(Core::ProxyType<Core::JSON::IElement>(parameter));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<PARAMETER>(recycler));
             }
             template <typename PARAMETER, typename GET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<2>&, const string& methodName, const GET_METHOD& getMethod, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const REALOBJECT&, const string&, PARAMETER&)> getter = getMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter](const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, getter, recycler](const string& method, const Message::Payload& inbound, Message::Payload& outbound) -> uint32_t {
                     uint32_t code;
-                    if (inbound.empty() == false) {
+                    if (inbound.IsEmpty() == false) {
                         code = Core::ERROR_UNAVAILABLE;
                     } else {
                         const string index = Message::Index(method);
-                        code = getter(*objectPtr, index, parameter);
-                        parameter.ToString(outbound);
+                        Core::ProxyType<PARAMETER> parameter(RecyclerType<PARAMETER>::Element(recycler));
+                        code = getter(*objectPtr, index, *parameter);
+                        outbound.Attach(Core::ProxyType<Core::JSON::IElement>(parameter));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, ParameterFactory());
             }
             template <typename PARAMETER, typename SET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<2>&, const string& methodName, REALOBJECT* objectPtr, const SET_METHOD& setMethod)
             {
                 std::function<uint32_t(REALOBJECT&, const string&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, setter](const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, setter](const string& method, const Message::Payload& inbound, Message::Payload&) -> uint32_t {
                     uint32_t code;
-                    if (inbound.empty() == false) {
+                    if (inbound.IsEmpty() == false) {
                         const string index = Message::Index(method);
-                        parameter.FromString(inbound);
-                        code = setter(*objectPtr, index, parameter);
+                        Inbound<PARAMETER> parameter(inbound);
+                        code = setter(*objectPtr, index, *parameter);
                     } else {
                         code = Core::ERROR_UNAVAILABLE;
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<PARAMETER>(recycler));
             }
             template <typename PARAMETER, typename GET_METHOD, typename SET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<2>&, const string& methodName, const GET_METHOD& getMethod, const SET_METHOD& setMethod, REALOBJECT* objectPtr)
@@ -836,20 +1514,21 @@ namespace Core {
                 std::function<uint32_t(const REALOBJECT&, const string&, PARAMETER&)> getter = getMethod;
                 std::function<uint32_t(REALOBJECT&, const string&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter, setter](const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                Core::ProxyType<RecyclerType<PARAMETER>> recycler(RecyclerType<PARAMETER>::Create());
+                PayloadFunction implementation = [objectPtr, getter, setter, recycler](const string& method, const Message::Payload& inbound, Message::Payload& outbound) -> uint32_t {
                     uint32_t code;
                     const string index = Message::Index(method);
-                    if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
-                        code = setter(*objectPtr, index, parameter);
+                    if (inbound.IsEmpty() == false) {
+                        Inbound<PARAMETER> parameter(inbound);
+                        code = setter(*objectPtr, index, *parameter);
                     } else {
-                        code = getter(*objectPtr, index, parameter);
-                        parameter.ToString(outbound);
+                        Core::ProxyType<PARAMETER> parameter(RecyclerType<PARAMETER>::Element(recycler));
+                        code = getter(*objectPtr, index, *parameter);
+                        outbound.Attach(Core::ProxyType<Core::JSON::IElement>(parameter));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<PARAMETER>(recycler));
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD>
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
@@ -864,46 +1543,44 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const INBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
-                    inbound.FromString(parameters);
-                    return (actualMethod(inbound));
+                Core::ProxyType<RecyclerType<INBOUND>> inbounds(RecyclerType<INBOUND>::Create());
+                PayloadFunction implementation = [actualMethod](const string&, const Message::Payload& parameters, Message::Payload&) -> uint32_t {
+                    Inbound<INBOUND> inbound(parameters);
+                    return (actualMethod(*inbound));
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<INBOUND>(inbounds));
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD>
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
-                    uint32_t code = actualMethod(outbound);
+                Core::ProxyType<RecyclerType<OUTBOUND>> outbounds(RecyclerType<OUTBOUND>::Create());
+                PayloadFunction implementation = [actualMethod, outbounds](const string&, const Message::Payload&, Message::Payload& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outbound(RecyclerType<OUTBOUND>::Element(outbounds));
+                    uint32_t code = actualMethod(*outbound);
                     if (code == Core::ERROR_NONE) {
-                        outbound.ToString(result);
-                    } else {
-                        result.clear();
+                        result.Attach(Core::ProxyType<Core::JSON::IElement>(outbound));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, ParameterFactory());
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD>
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const INBOUND&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
-                    inbound.FromString(parameters);
-                    uint32_t code = actualMethod(inbound, outbound);
+                Core::ProxyType<RecyclerType<INBOUND>> inbounds(RecyclerType<INBOUND>::Create());
+                Core::ProxyType<RecyclerType<OUTBOUND>> outbounds(RecyclerType<OUTBOUND>::Create());
+                PayloadFunction implementation = [actualMethod, outbounds](const string&, const Message::Payload& parameters, Message::Payload& result) -> uint32_t {
+                    Inbound<INBOUND> inbound(parameters);
+                    Core::ProxyType<OUTBOUND> outbound(RecyclerType<OUTBOUND>::Element(outbounds));
+                    uint32_t code = actualMethod(*inbound, *outbound);
                     if (code == Core::ERROR_NONE) {
-                        outbound.ToString(result);
-                    } else {
-                        result.clear();
+                        result.Attach(Core::ProxyType<Core::JSON::IElement>(outbound));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<INBOUND>(inbounds));
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD, typename REALOBJECT>
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
@@ -918,46 +1595,44 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
-                    inbound.FromString(parameters);
-                    return (actualMethod(inbound));
+                Core::ProxyType<RecyclerType<INBOUND>> inbounds(RecyclerType<INBOUND>::Create());
+                PayloadFunction implementation = [actualMethod](const string&, const Message::Payload& parameters, Message::Payload&) -> uint32_t {
+                    Inbound<INBOUND> inbound(parameters);
+                    return (actualMethod(*inbound));
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<INBOUND>(inbounds));
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD, typename REALOBJECT>
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
-                    uint32_t code = actualMethod(outbound);
+                Core::ProxyType<RecyclerType<OUTBOUND>> outbounds(RecyclerType<OUTBOUND>::Create());
+                PayloadFunction implementation = [actualMethod, outbounds](const string&, const Message::Payload&, Message::Payload& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outbound(RecyclerType<OUTBOUND>::Element(outbounds));
+                    uint32_t code = actualMethod(*outbound);
                     if (code == Core::ERROR_NONE) {
-                        outbound.ToString(result);
-                    } else {
-                        result.clear();
+                        result.Attach(Core::ProxyType<Core::JSON::IElement>(outbound));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, ParameterFactory());
             }
             template <typename INBOUND, typename OUTBOUND, typename METHOD, typename REALOBJECT>
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const INBOUND&, OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1, std::placeholders::_2);
-                InvokeFunction implementation = [actualMethod](const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
-                    inbound.FromString(parameters);
-                    uint32_t code = actualMethod(inbound, outbound);
+                Core::ProxyType<RecyclerType<INBOUND>> inbounds(RecyclerType<INBOUND>::Create());
+                Core::ProxyType<RecyclerType<OUTBOUND>> outbounds(RecyclerType<OUTBOUND>::Create());
+                PayloadFunction implementation = [actualMethod, outbounds](const string&, const Message::Payload& parameters, Message::Payload& result) -> uint32_t {
+                    Inbound<INBOUND> inbound(parameters);
+                    Core::ProxyType<OUTBOUND> outbound(RecyclerType<OUTBOUND>::Element(outbounds));
+                    uint32_t code = actualMethod(*inbound, *outbound);
                     if (code == Core::ERROR_NONE) {
-                        outbound.ToString(result);
-                    } else {
-                        result.clear();
+                        result.Attach(Core::ProxyType<Core::JSON::IElement>(outbound));
                     }
                     return (code);
                 };
-                Register(methodName, implementation);
+                Register(methodName, implementation, Factory<INBOUND>(inbounds));
             }
             template <typename INBOUND, typename METHOD>
             void InternalAnnounce(const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
@@ -1032,7 +1707,7 @@ namespace Core {
 
         private:
             Core::CriticalSection _adminLock;
-            HandlerMap _handlers;
+            Table _handlers;
             ObserverMap _observers;
             NotificationFunction _notificationFunction;
             const std::vector<uint8_t> _versions;
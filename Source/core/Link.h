@@ -5,6 +5,7 @@
 
 #include "Portability.h"
 #include "Proxy.h"
+#include "SocketPort.h"
 
 namespace WPEFramework {
 namespace Core {
@@ -190,6 +191,14 @@ namespace Core {
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
+            virtual uint16_t Gather(SocketPort::Slice slices[], const uint16_t maxSlices)
+            {
+                return (_parent.Gather(slices, maxSlices));
+            }
+            virtual void Gathered()
+            {
+                _parent.Gathered();
+            }
 
             // Signal a state change, Opened, Closed or Accepted
             virtual void StateChange()
@@ -358,6 +367,46 @@ namespace Core {
             return (_deserialiserImpl.Deserialize(dataFrame, receivedSize));
         }
 
+        uint16_t Gather(SocketPort::Slice slices[], const uint16_t maxSlices)
+        {
+            return (_Gather<LINK, INBOUND, OUTBOUND, ALLOCATOR>(slices, maxSlices));
+        }
+        void Gathered()
+        {
+            _Gathered<LINK, INBOUND, OUTBOUND, ALLOCATOR>();
+        }
+
+        // -------------------------------------------------------------------------
+        // If the serializer can hand out its data as is, the socket sends it from there.
+        // -------------------------------------------------------------------------
+        HAS_MEMBER(Gather, hasGather);
+
+        typedef hasGather<typename OUTBOUND::Serializer, uint16_t (OUTBOUND::Serializer::*)(SocketPort::Slice[], const uint16_t)> TraitGather;
+
+        template <typename A, typename B, typename C, typename D>
+        inline typename Core::TypeTraits::enable_if<LinkType<A, B, C, D>::TraitGather::value, uint16_t>::type
+        _Gather(SocketPort::Slice slices[], const uint16_t maxSlices)
+        {
+            return (_serializerImpl.Gather(slices, maxSlices));
+        }
+        template <typename A, typename B, typename C, typename D>
+        inline typename Core::TypeTraits::enable_if<!LinkType<A, B, C, D>::TraitGather::value, uint16_t>::type
+        _Gather(SocketPort::Slice[], const uint16_t)
+        {
+            return (0);
+        }
+        template <typename A, typename B, typename C, typename D>
+        inline typename Core::TypeTraits::enable_if<LinkType<A, B, C, D>::TraitGather::value, void>::type
+        _Gathered()
+        {
+            _serializerImpl.Gathered();
+        }
+        template <typename A, typename B, typename C, typename D>
+        inline typename Core::TypeTraits::enable_if<!LinkType<A, B, C, D>::TraitGather::value, void>::type
+        _Gathered()
+        {
+        }
+
     private:
         SerializerImpl _serializerImpl;
         DeserializerImpl _deserialiserImpl;
@@ -373,8 +373,8 @@ namespace Core {
         typedef std::list<Message> PendingList;
 
     public:
-        SocketNetlink(const Core::NodeId& destination)
-            : SocketDatagram(false, destination, Core::NodeId(), 512, 1024)
+        SocketNetlink(const Core::NodeId& destination, const uint16_t sendBufferSize = 512, const uint16_t receiveBufferSize = 1024)
+            : SocketDatagram(false, destination, Core::NodeId(), sendBufferSize, receiveBufferSize)
             , _adminLock()
         {
         }
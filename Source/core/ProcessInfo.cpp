@@ -1,5 +1,15 @@
 #include "ProcessInfo.h"
 #include "FileSystem.h"
+#include "Singleton.h"
+#include "Time.h"
+
+#ifdef __LINUX__
+#include "Netlink.h"
+#include "ResourceMonitor.h"
+#include <atomic>
+#include <linux/cn_proc.h>
+#include <unordered_map>
+#endif
 
 #ifdef __WINDOWS__
 #include <psapi.h>
@@ -19,6 +29,59 @@ namespace WPEFramework {
 namespace Core {
 #ifndef __WINDOWS__
     const uint32_t PageSize = getpagesize();
+
+    static int OpenStatistics(const uint32_t pid, const TCHAR file[])
+    {
+        TCHAR path[48];
+
+        snprintf(path, sizeof(path), "/proc/%u/%s", pid, file);
+
+        return (open(path, O_RDONLY | O_CLOEXEC));
+    }
+
+    // The sizes from statm, all at once.
+    static bool ReadStatistics(const int fd, uint64_t& allocated, uint64_t& resident, uint64_t& shared)
+    {
+        bool result = false;
+        TCHAR buffer[128];
+        ssize_t size = pread(fd, buffer, sizeof(buffer) - 1, 0);
+
+        if (size > 0) {
+            unsigned long pages[3];
+
+            buffer[size] = '\0';
+
+            if (sscanf(buffer, "%lu %lu %lu", &pages[0], &pages[1], &pages[2]) == 3) {
+                allocated = static_cast<uint64_t>(pages[0]) * PageSize;
+                resident = static_cast<uint64_t>(pages[1]) * PageSize;
+                shared = static_cast<uint64_t>(pages[2]) * PageSize;
+                result = true;
+            }
+        }
+
+        return (result);
+    }
+
+    // The proportional set size from smaps_rollup, the kernel sums it up for us.
+    static uint64_t ReadProportional(const int fd)
+    {
+        uint64_t result = 0;
+        TCHAR buffer[1024];
+        ssize_t size = pread(fd, buffer, sizeof(buffer) - 1, 0);
+
+        if (size > 0) {
+            const TCHAR* line;
+            unsigned long kiloBytes;
+
+            buffer[size] = '\0';
+
+            if (((line = strstr(buffer, "\nPss:")) != nullptr) && (sscanf(line, "\nPss: %lu", &kiloBytes) == 1)) {
+                result = static_cast<uint64_t>(kiloBytes) * 1024;
+            }
+        }
+
+        return (result);
+    }
 #endif
 
 #ifdef __WINDOWS__
@@ -94,14 +157,54 @@ namespace Core {
         return (string(fullname));
     }
 
-    // Iterate over Processes
-    static void FindChildren(const uint32_t parent, std::list<uint32_t>& children)
+    // The state and the parent from a stat file of /proc.
+    static bool ReadStat(const TCHAR path[], char& state, uint32_t& parent)
+    {
+        bool result = false;
+        TCHAR buffer[512];
+        int fd;
+
+        if ((fd = open(path, O_RDONLY | O_CLOEXEC)) > 0) {
+            ssize_t size = read(fd, buffer, sizeof(buffer) - 1);
+            if (size > 0) {
+                int ppid = 0;
+
+                buffer[size] = '\0';
+
+                // The name is in between brackets, and may hold brackets itself.
+                const TCHAR* end = strrchr(buffer, ')');
+
+                if ((end != nullptr) && (sscanf(end, ") %c %d", &state, &ppid) == 2)) {
+                    parent = static_cast<uint32_t>(ppid);
+                    result = true;
+                }
+            }
+
+            close(fd);
+        }
+
+        return (result);
+    }
+
+    static uint32_t ParentId(const uint32_t pid)
+    {
+        TCHAR path[48];
+        char state;
+        uint32_t parent = 0;
+
+        snprintf(path, sizeof(path), "/proc/%u/stat", pid);
+
+        ReadStat(path, state, parent);
+
+        return (parent);
+    }
+
+    template <typename ACTION>
+    static void ScanProcesses(ACTION action)
     {
         DIR* dp;
         struct dirent* ep;
 
-        children.clear();
-
         dp = opendir("/proc");
         if (dp != nullptr) {
             while (nullptr != (ep = readdir(dp))) {
@@ -111,23 +214,7 @@ namespace Core {
                 pid = strtol(ep->d_name, &endptr, 10);
 
                 if ('\0' == endptr[0]) {
-                    // We have a valid PID, Find, the parent of this process..
-                    TCHAR buffer[512];
-                    int fd;
-
-                    snprintf(buffer, sizeof(buffer), "/proc/%d/stat", pid);
-                    if ((fd = open(buffer, O_RDONLY)) > 0) {
-                        if (read(fd, buffer, sizeof(buffer)) > 0) {
-                            int ppid = 0;
-                            sscanf(buffer, "%*d (%*[^)]) %*c %d", &ppid);
-
-                            if (static_cast<uint32_t>(ppid) == parent) {
-                                children.push_back(pid);
-                            }
-                        }
-
-                        close(fd);
-                    }
+                    action(static_cast<uint32_t>(pid));
                 }
             }
 
@@ -135,43 +222,562 @@ namespace Core {
         }
     }
 
-    // Iterate over Processes
-    static void FindPid(const string& item, const bool exact, std::list<uint32_t>& pids)
-    {
-        DIR* dp;
-        struct dirent* ep;
+#ifdef __LINUX__
+    // The process table, as the kernel reports changes to it through the proc connector. With it,
+    // looking up processes by name or by parent does not need to open every entry in /proc.
+    // Listening to the proc connector requires CAP_NET_ADMIN, if the kernel does not let us in,
+    // the lookups keep on scanning /proc.
+    // Only one thread at a time changes the table, under the _changeLock. What it needs from /proc
+    // is read before it takes the _adminLock, so the lookups are never held up by the file system.
+    class ProcessTable : public SocketNetlink {
+    private:
+        ProcessTable(const ProcessTable&) = delete;
+        ProcessTable& operator=(const ProcessTable&) = delete;
+
+        friend class SingletonType<ProcessTable>;
+
+        static constexpr uint32_t SubscribeTime = 1000;
+
+        enum state {
+            UNINITIALIZED,
+            ACTIVE,
+            UNAVAILABLE
+        };
+
+        class Subscription : public ConnectorType<CN_IDX_PROC, CN_VAL_PROC> {
+        private:
+            Subscription() = delete;
+            Subscription(const Subscription&) = delete;
+            Subscription& operator=(const Subscription&) = delete;
+
+        public:
+            Subscription(const bool listen)
+                : ConnectorType<CN_IDX_PROC, CN_VAL_PROC>()
+                , _listen(listen)
+            {
+            }
+            ~Subscription()
+            {
+            }
 
-        pids.clear();
+        private:
+            uint16_t Message(uint8_t stream[], const uint16_t length) const override
+            {
+                const uint32_t operation = (_listen == true ? PROC_CN_MCAST_LISTEN : PROC_CN_MCAST_IGNORE);
 
-        string fileName(Core::File::FileNameExtended(item));
-        bool fullMatch(exact && (Core::File::PathName(item).empty() == false));
+                ASSERT(length >= sizeof(operation));
 
-        dp = opendir("/proc");
-        if (dp != nullptr) {
-            while (nullptr != (ep = readdir(dp))) {
-                int pid;
-                char* endptr;
+                ::memcpy(stream, &operation, sizeof(operation));
 
-                pid = strtol(ep->d_name, &endptr, 10);
+                return (sizeof(operation));
+            }
+            uint16_t Message(const uint8_t[], const uint16_t) override
+            {
+                // The kernel does not echo our sequence number in its acknowledge, so it
+                // arrives as any other process event.
+                return (0);
+            }
 
-                if ('\0' == endptr[0]) {
-                    // We have a valid PID, Find, the parent of this process..
-                    TCHAR buffer[512];
-                    ProcessName(pid, buffer, sizeof(buffer));
+        private:
+            const bool _listen;
+        };
+
+        struct Entry {
+            uint32_t Parent;
+            string Name;
+            // The leading thread exited, but others did not (yet).
+            bool Leaderless;
+        };
+
+        // An event, with what had to be read from /proc to apply it.
+        struct Change {
+            struct proc_event Event;
+            string Name;
+            bool Alive;
+        };
+
+        typedef std::unordered_map<uint32_t, Entry> Processes;
+        typedef std::unordered_map<uint32_t, std::vector<uint32_t>> ChildMap;
+        typedef std::unordered_map<string, std::vector<uint32_t>> NameMap;
+        typedef std::vector<Change> Changes;
+
+        ProcessTable()
+            : SocketNetlink(NodeId(NETLINK_CONNECTOR, 0, CN_IDX_PROC), 64, 0x8000)
+            , _subscribeLock()
+            , _changeLock()
+            , _adminLock()
+            , _state(UNINITIALIZED)
+            , _seeding(false)
+            , _pending()
+            , _acknowledged(false, true)
+            , _result(~0)
+            , _processes()
+            , _children()
+            , _names()
+        {
+        }
+
+    public:
+        static ProcessTable& Instance()
+        {
+            // Our socket is served by the resource monitor, so it has to be around before, and
+            // after, we are.
+            ResourceMonitor::Instance();
+
+            return (SingletonType<ProcessTable>::Instance());
+        }
+        ~ProcessTable() override
+        {
+            if (_state == ACTIVE) {
+                Subscription ignore(false);
+
+                Send(ignore, SubscribeTime);
+            }
+
+            Close(Core::infinite);
+        }
+
+    public:
+        bool Children(const uint32_t parent, std::list<uint32_t>& pids)
+        {
+            bool result = IsActive();
+
+            if (result == true) {
+                _adminLock.Lock();
+
+                ChildMap::const_iterator index(_children.find(parent));
+
+                if (index != _children.end()) {
+                    pids.assign(index->second.begin(), index->second.end());
+                }
+
+                _adminLock.Unlock();
+            }
 
-                    if (fullMatch == true) {
-                        if (item == buffer) {
+            return (result);
+        }
+        bool Find(const string& fileName, const string& fullName, std::list<uint32_t>& pids)
+        {
+            bool result = IsActive();
+
+            if (result == true) {
+                _adminLock.Lock();
+
+                NameMap::const_iterator index(_names.find(fileName));
+
+                if (index != _names.end()) {
+                    for (const uint32_t pid : index->second) {
+                        Processes::const_iterator entry(_processes.find(pid));
+
+                        if ((fullName.empty() == true) || ((entry != _processes.end()) && (entry->second.Name == fullName))) {
                             pids.push_back(pid);
                         }
-                    } else {
-                        if (fileName == Core::File::FileNameExtended(string(buffer))) {
-                            pids.push_back(pid);
+                    }
+                }
+
+                _adminLock.Unlock();
+            }
+
+            return (result);
+        }
+
+        uint16_t Deserialize(const uint8_t dataFrame[], const uint16_t receivedSize) override
+        {
+            Netlink::Frames frames(dataFrame, receivedSize);
+            Changes changes;
+
+            while (frames.Next() == true) {
+                const struct cn_msg* message(reinterpret_cast<const struct cn_msg*>(frames.Data()));
+
+                if ((frames.Size() >= sizeof(struct cn_msg)) && (message->id.idx == CN_IDX_PROC) && (message->id.val == CN_VAL_PROC) && (message->len >= sizeof(struct proc_event)) && ((sizeof(struct cn_msg) + message->len) <= frames.Size())) {
+                    Change change;
+
+                    ::memcpy(&(change.Event), message->data, sizeof(change.Event));
+                    change.Alive = false;
+
+                    if (change.Event.what == proc_event::PROC_EVENT_NONE) {
+                        // The acknowledge on our subscription (or on one of another listener).
+                        if ((_state == UNINITIALIZED) && (message->ack == 1)) {
+                            _result = change.Event.event_data.ack.err;
+                            _acknowledged.SetEvent();
                         }
+                    } else if ((change.Event.what == proc_event::PROC_EVENT_FORK) || (change.Event.what == proc_event::PROC_EVENT_EXEC) || (change.Event.what == proc_event::PROC_EVENT_EXIT)) {
+                        changes.push_back(std::move(change));
                     }
                 }
             }
 
-            (void)closedir(dp);
+            if (changes.empty() == false) {
+                _changeLock.Lock();
+
+                _adminLock.Lock();
+
+                if (_seeding == true) {
+                    // Applied once the table is seeded, the table does not know these processes yet.
+                    _pending.insert(_pending.end(), changes.begin(), changes.end());
+                    changes.clear();
+                }
+
+                _adminLock.Unlock();
+
+                Apply(changes);
+
+                _changeLock.Unlock();
+            }
+
+            return (receivedSize);
+        }
+
+    private:
+        void StateChange() override
+        {
+            // Once we missed events, the table can not be trusted anymore.
+            if ((HasError() == true) && (_state == ACTIVE)) {
+                TRACE_L1("Lost track of the process events, falling back to scanning /proc.");
+                _state = UNAVAILABLE;
+            }
+        }
+        bool IsActive()
+        {
+            if (_state == UNINITIALIZED) {
+                // Setting up waits for the resource monitor, which can not be done from within
+                // its own thread. Scan till another thread sets it up.
+                if (ResourceMonitor::Instance().IsMonitor(Thread::ThreadId()) == false) {
+                    _subscribeLock.Lock();
+
+                    if (_state == UNINITIALIZED) {
+                        Subscribe();
+                    }
+
+                    _subscribeLock.Unlock();
+                }
+            }
+
+            return (_state == ACTIVE);
+        }
+        void Subscribe()
+        {
+            state result = UNAVAILABLE;
+
+            if (Open(SubscribeTime) == ERROR_NONE) {
+                Subscription listen(true);
+
+                _adminLock.Lock();
+                _seeding = true;
+                _pending.clear();
+                _adminLock.Unlock();
+
+                _acknowledged.ResetEvent();
+
+                if ((Send(listen, SubscribeTime) == ERROR_NONE) && (_acknowledged.Lock(SubscribeTime) == ERROR_NONE) && (_result == 0)) {
+                    // Subscribed first, so everything that happens while reading /proc reaches us
+                    // afterwards, and is applied on top of what is read. Zombies exited before we
+                    // listened, nothing would ever remove them.
+                    Processes seed;
+
+                    ScanProcesses([&seed](const uint32_t pid) {
+                        TCHAR path[48];
+                        char state;
+                        uint32_t parent;
+
+                        snprintf(path, sizeof(path), "/proc/%u/stat", pid);
+
+                        if ((ReadStat(path, state, parent) == true) && (state != 'Z') && (state != 'X')) {
+                            Entry& entry(seed[pid]);
+
+                            entry.Parent = parent;
+                            entry.Name = ExecutableName(pid);
+                            entry.Leaderless = false;
+                        }
+                    });
+
+                    _changeLock.Lock();
+
+                    _adminLock.Lock();
+
+                    for (const std::pair<const uint32_t, Entry>& entry : seed) {
+                        Insert(entry.first, entry.second.Parent, entry.second.Name, false);
+                    }
+
+                    Changes pending(std::move(_pending));
+                    _pending.clear();
+                    _seeding = false;
+
+                    _adminLock.Unlock();
+
+                    Apply(pending);
+
+                    _changeLock.Unlock();
+
+                    result = ACTIVE;
+                } else {
+                    _adminLock.Lock();
+                    _seeding = false;
+                    _pending.clear();
+                    _adminLock.Unlock();
+
+                    Close(Core::infinite);
+                }
+            }
+
+            if (result != ACTIVE) {
+                TRACE_L1("Process events are not available, looking up processes through /proc.");
+            }
+
+            _state = result;
+        }
+        // Called with the _changeLock taken, so the table is only read here, no need for the _adminLock.
+        void Apply(Changes& changes)
+        {
+            if (changes.empty() == false) {
+                // First read what is needed from /proc.
+                for (Change& change : changes) {
+                    const struct proc_event& event(change.Event);
+
+                    if (event.what == proc_event::PROC_EVENT_FORK) {
+                        if (event.event_data.fork.child_pid == event.event_data.fork.child_tgid) {
+                            Processes::const_iterator parent(_processes.find(event.event_data.fork.parent_tgid));
+
+                            change.Name = (parent != _processes.end() ? parent->second.Name : ExecutableName(event.event_data.fork.child_tgid));
+                        }
+                    } else if (event.what == proc_event::PROC_EVENT_EXEC) {
+                        change.Name = ExecutableName(event.event_data.exec.process_tgid);
+                    } else if (event.what == proc_event::PROC_EVENT_EXIT) {
+                        const uint32_t tgid = event.event_data.exit.process_tgid;
+
+                        if (event.event_data.exit.process_pid == tgid) {
+                            change.Alive = IsAlive(tgid);
+                        } else {
+                            Processes::const_iterator index(_processes.find(tgid));
+
+                            if ((index != _processes.end()) && (index->second.Leaderless == true)) {
+                                change.Alive = IsAlive(tgid);
+                            }
+                        }
+                    }
+                }
+
+                std::vector<uint32_t> orphans;
+
+                _adminLock.Lock();
+
+                for (const Change& change : changes) {
+                    const struct proc_event& event(change.Event);
+
+                    switch (event.what) {
+                    case proc_event::PROC_EVENT_FORK:
+                        // Threads are not in the table, only processes are. A pid that is still in
+                        // the table belonged to a process of which we missed the exit.
+                        if (event.event_data.fork.child_pid == event.event_data.fork.child_tgid) {
+                            Insert(event.event_data.fork.child_tgid, event.event_data.fork.parent_tgid, change.Name, true);
+                        }
+                        break;
+                    case proc_event::PROC_EVENT_EXEC: {
+                        Processes::iterator index(_processes.find(event.event_data.exec.process_tgid));
+
+                        if (index != _processes.end()) {
+                            Rename(index, change.Name);
+                        }
+                        break;
+                    }
+                    case proc_event::PROC_EVENT_EXIT: {
+                        // The process is gone with its last thread, which is not necessarily the leading one.
+                        const uint32_t tgid = event.event_data.exit.process_tgid;
+                        Processes::iterator index(_processes.find(tgid));
+
+                        if (index != _processes.end()) {
+                            if ((event.event_data.exit.process_pid == tgid) || (index->second.Leaderless == true)) {
+                                if (change.Alive == true) {
+                                    index->second.Leaderless = true;
+                                } else {
+                                    Remove(index, orphans);
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                    }
+                }
+
+                _adminLock.Unlock();
+
+                if (orphans.empty() == false) {
+                    // The orphans are adopted by now, find out by whom.
+                    std::vector<uint32_t> parents;
+
+                    parents.reserve(orphans.size());
+
+                    for (const uint32_t child : orphans) {
+                        parents.push_back(ParentId(child));
+                    }
+
+                    _adminLock.Lock();
+
+                    for (uint32_t index = 0; index < orphans.size(); index++) {
+                        Processes::iterator entry(_processes.find(orphans[index]));
+
+                        if (entry != _processes.end()) {
+                            entry->second.Parent = parents[index];
+                            _children[parents[index]].push_back(orphans[index]);
+                        }
+                    }
+
+                    _adminLock.Unlock();
+                }
+
+                changes.clear();
+            }
+        }
+        // Any thread of the process that did not exit yet.
+        static bool IsAlive(const uint32_t tgid)
+        {
+            bool result = false;
+            TCHAR path[64];
+            DIR* dp;
+
+            snprintf(path, sizeof(path), "/proc/%u/task", tgid);
+
+            if ((dp = opendir(path)) != nullptr) {
+                struct dirent* ep;
+
+                while ((result == false) && ((ep = readdir(dp)) != nullptr)) {
+                    char* end;
+                    const unsigned long tid = strtoul(ep->d_name, &end, 10);
+
+                    if ((ep->d_name[0] != '.') && (*end == '\0')) {
+                        char state;
+                        uint32_t parent;
+
+                        snprintf(path, sizeof(path), "/proc/%u/task/%lu/stat", tgid, tid);
+
+                        result = ((ReadStat(path, state, parent) == true) && (state != 'Z') && (state != 'X'));
+                    }
+                }
+
+                closedir(dp);
+            }
+
+            return (result);
+        }
+        void Insert(const uint32_t pid, const uint32_t parent, const string& name, const bool replace)
+        {
+            Processes::iterator index(_processes.find(pid));
+
+            if (index == _processes.end()) {
+                Entry& entry(_processes[pid]);
+
+                entry.Parent = parent;
+                entry.Name = name;
+                entry.Leaderless = false;
+                _children[parent].push_back(pid);
+                _names[File::FileNameExtended(name)].push_back(pid);
+            } else if (replace == true) {
+                Unlink(_children, index->second.Parent, pid);
+                index->second.Parent = parent;
+                index->second.Leaderless = false;
+                _children[parent].push_back(pid);
+                Rename(index, name);
+            }
+        }
+        void Rename(Processes::iterator& index, const string& name)
+        {
+            Unlink(_names, File::FileNameExtended(index->second.Name), index->first);
+            index->second.Name = name;
+            _names[File::FileNameExtended(name)].push_back(index->first);
+        }
+        void Remove(Processes::iterator& index, std::vector<uint32_t>& orphans)
+        {
+            const uint32_t pid = index->first;
+
+            Unlink(_children, index->second.Parent, pid);
+            Unlink(_names, File::FileNameExtended(index->second.Name), pid);
+            _processes.erase(index);
+
+            ChildMap::iterator children(_children.find(pid));
+
+            if (children != _children.end()) {
+                orphans.insert(orphans.end(), children->second.begin(), children->second.end());
+                _children.erase(children);
+            }
+        }
+        template <typename KEY>
+        static void Unlink(std::unordered_map<KEY, std::vector<uint32_t>>& map, const KEY& key, const uint32_t pid)
+        {
+            typename std::unordered_map<KEY, std::vector<uint32_t>>::iterator index(map.find(key));
+
+            if (index != map.end()) {
+                std::vector<uint32_t>::iterator entry(std::find(index->second.begin(), index->second.end(), pid));
+
+                if (entry != index->second.end()) {
+                    *entry = index->second.back();
+                    index->second.pop_back();
+                }
+                if (index->second.empty() == true) {
+                    map.erase(index);
+                }
+            }
+        }
+
+    private:
+        CriticalSection _subscribeLock;
+        CriticalSection _changeLock;
+        CriticalSection _adminLock;
+        std::atomic<state> _state;
+        bool _seeding;
+        Changes _pending;
+        Event _acknowledged;
+        uint32_t _result;
+        Processes _processes;
+        ChildMap _children;
+        NameMap _names;
+    };
+#endif
+
+    // Iterate over Processes
+    static void FindChildren(const uint32_t parent, std::list<uint32_t>& children)
+    {
+        children.clear();
+
+#ifdef __LINUX__
+        if (ProcessTable::Instance().Children(parent, children) == false)
+#endif
+        {
+            ScanProcesses([&children, parent](const uint32_t pid) {
+                if (ParentId(pid) == parent) {
+                    children.push_back(pid);
+                }
+            });
+        }
+    }
+
+    // Iterate over Processes
+    static void FindPid(const string& item, const bool exact, std::list<uint32_t>& pids)
+    {
+        pids.clear();
+
+        string fileName(Core::File::FileNameExtended(item));
+        bool fullMatch(exact && (Core::File::PathName(item).empty() == false));
+
+#ifdef __LINUX__
+        if (ProcessTable::Instance().Find(fileName, (fullMatch == true ? item : string()), pids) == false)
+#endif
+        {
+            ScanProcesses([&pids, &item, &fileName, fullMatch](const uint32_t pid) {
+                TCHAR buffer[512];
+                ProcessName(pid, buffer, sizeof(buffer));
+
+                if (fullMatch == true) {
+                    if (item == buffer) {
+                        pids.push_back(pid);
+                    }
+                } else {
+                    if (fileName == Core::File::FileNameExtended(string(buffer))) {
+                        pids.push_back(pid);
+                    }
+                }
+            });
         }
     }
 
@@ -280,83 +886,47 @@ namespace Core {
     }
     uint64_t ProcessInfo::Allocated() const
     {
-        uint64_t result = 0;
-
-#ifdef __WINDOWS__
-        if (_handle) {
-            PROCESS_MEMORY_COUNTERS pmc;
-            if (GetProcessMemoryInfo(_handle, &pmc, sizeof(pmc))) {
-                result = pmc.WorkingSetSize;
-            }
-        }
-#else
-        int fd;
-        TCHAR buffer[128];
-        int VmSize = 0;
-
-        snprintf(buffer, sizeof(buffer), "/proc/%d/statm", _pid);
-        if ((fd = open(buffer, O_RDONLY)) > 0) {
-            if (read(fd, buffer, sizeof(buffer)) > 0) {
-                sscanf(buffer, "%d", &VmSize);
-                result = VmSize * PageSize;
-            }
-            close(fd);
-        }
-#endif
-
-        return (result);
+        return (Statistics().Allocated());
     }
     uint64_t ProcessInfo::Resident() const
     {
-        uint64_t result = 0;
-
-#ifdef __WINDOWS__
-        if (_handle) {
-            PROCESS_MEMORY_COUNTERS pmc;
-            if (GetProcessMemoryInfo(_handle, &pmc, sizeof(pmc))) {
-                result = pmc.QuotaPagedPoolUsage + pmc.QuotaNonPagedPoolUsage;
-            }
-        }
-#else
-        int fd;
-        TCHAR buffer[128];
-        int VmRSS = 0;
-
-        snprintf(buffer, sizeof(buffer), "/proc/%d/statm", _pid);
-        if ((fd = open(buffer, O_RDONLY)) > 0) {
-            if (read(fd, buffer, sizeof(buffer)) > 0) {
-                sscanf(buffer, "%*d %d", &VmRSS);
-                result = VmRSS * PageSize;
-            }
-            close(fd);
-        }
-#endif
-
-        return (result);
+        return (Statistics().Resident());
     }
     uint64_t ProcessInfo::Shared() const
     {
-        uint64_t result = 0;
+        return (Statistics().Shared());
+    }
+    ProcessInfo::Memory ProcessInfo::Statistics(const bool proportional VARIABLE_IS_NOT_USED) const
+    {
+        Memory result;
 
 #ifdef __WINDOWS__
         if (_handle) {
             PROCESS_MEMORY_COUNTERS pmc;
             if (GetProcessMemoryInfo(_handle, &pmc, sizeof(pmc))) {
-                result = pmc.QuotaPagedPoolUsage + pmc.QuotaNonPagedPoolUsage;
+                result = Memory(pmc.WorkingSetSize, pmc.QuotaPagedPoolUsage + pmc.QuotaNonPagedPoolUsage, pmc.QuotaPagedPoolUsage + pmc.QuotaNonPagedPoolUsage, 0);
             }
         }
 #else
         int fd;
-        TCHAR buffer[128];
-        int Share = 0;
 
-        snprintf(buffer, sizeof(buffer), "/proc/%d/statm", _pid);
-        if ((fd = open(buffer, O_RDONLY)) > 0) {
-            if (read(fd, buffer, sizeof(buffer)) > 0) {
-                sscanf(buffer, "%*d %*d %d", &Share);
-                result = Share * PageSize;
+        if ((fd = OpenStatistics(_pid, _T("statm"))) != -1) {
+            uint64_t allocated, resident, shared;
+
+            if (ReadStatistics(fd, allocated, resident, shared) == true) {
+                uint64_t pss = 0;
+
+                close(fd);
+
+                if ((proportional == true) && ((fd = OpenStatistics(_pid, _T("smaps_rollup"))) != -1)) {
+                    pss = ReadProportional(fd);
+                    close(fd);
+                }
+
+                result = Memory(allocated, resident, shared, pss);
+            } else {
+                close(fd);
             }
-            close(fd);
         }
 #endif
 
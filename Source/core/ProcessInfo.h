@@ -100,6 +100,55 @@ namespace Core {
             uint32_t _index;
         };
 
+        // All memory figures of a process, taken at the same moment.
+        class EXTERNAL Memory {
+        public:
+            Memory()
+                : _allocated(0)
+                , _resident(0)
+                , _shared(0)
+                , _proportional(0)
+            {
+            }
+            Memory(const uint64_t allocated, const uint64_t resident, const uint64_t shared, const uint64_t proportional)
+                : _allocated(allocated)
+                , _resident(resident)
+                , _shared(shared)
+                , _proportional(proportional)
+            {
+            }
+            Memory(const Memory&) = default;
+            Memory& operator=(const Memory&) = default;
+            ~Memory()
+            {
+            }
+
+        public:
+            inline uint64_t Allocated() const
+            {
+                return (_allocated);
+            }
+            inline uint64_t Resident() const
+            {
+                return (_resident);
+            }
+            inline uint64_t Shared() const
+            {
+                return (_shared);
+            }
+            // Proportional set size, only available if it was asked for, and the kernel has it.
+            inline uint64_t Proportional() const
+            {
+                return (_proportional);
+            }
+
+        private:
+            uint64_t _allocated;
+            uint64_t _resident;
+            uint64_t _shared;
+            uint64_t _proportional;
+        };
+
     public:
         // Current Process Information
         ProcessInfo();
@@ -206,6 +255,9 @@ namespace Core {
         uint64_t Allocated() const;
         uint64_t Resident() const;
         uint64_t Shared() const;
+
+        // Allocated, resident and shared in one read, and the proportional set size if asked for.
+        Memory Statistics(const bool proportional = false) const;
         string Name() const;
         string Executable() const;
         uint32_t Group(const string& groupName);
@@ -261,6 +261,10 @@ namespace Core {
         {
             return (m_Queue.empty());
         }
+        inline bool IsDisabled() const
+        {
+            return (m_State == DISABLED);
+        }
         inline bool IsFull() const
         {
             return (m_Queue.size() >= m_MaxSlots);
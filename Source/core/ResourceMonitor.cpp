@@ -1,10 +1,107 @@
 #include "ResourceMonitor.h"
+#include "Number.h"
 #include "Singleton.h"
+#include "SystemInfo.h"
+
+#ifndef RESOURCE_MONITOR_SHARDS
+#define RESOURCE_MONITOR_SHARDS 1
+#endif
 
 namespace WPEFramework {
 
 namespace Core {
 
+    ResourceMonitor::ResourceMonitor()
+        : _shards()
+    {
+        uint32_t shards = RESOURCE_MONITOR_SHARDS;
+        string value;
+
+        if (SystemInfo::GetEnvironment(_T("RESOURCE_MONITOR_SHARDS"), value) == true) {
+            shards = ::atoi(value.c_str());
+        }
+
+        if (shards == 0) {
+            shards = 1;
+        } else if (shards > 32) {
+            shards = 32;
+        }
+
+        if (shards == 1) {
+            _shards.push_back(new ResourceMonitorBase());
+        } else {
+            const string name(_T("Monitor::") + ClassNameOnly(typeid(IResource).name()).Text());
+
+            for (uint32_t index = 0; index < shards; index++) {
+                _shards.push_back(new ResourceMonitorBase(name + '[' + Core::NumberType<uint32_t>(index).Text() + ']'));
+            }
+        }
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* shard : _shards) {
+            delete shard;
+        }
+    }
+
+    bool ResourceMonitor::IsMonitor(const ::ThreadId id) const
+    {
+        std::vector<ResourceMonitorBase*>::const_iterator index(_shards.cbegin());
+
+        while ((index != _shards.cend()) && ((*index)->Id() != id)) {
+            index++;
+        }
+
+        return (index != _shards.cend());
+    }
+
+    uint32_t ResourceMonitor::Runs() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* shard : _shards) {
+            result += shard->Runs();
+        }
+
+        return (result);
+    }
+
+    uint32_t ResourceMonitor::Count() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* shard : _shards) {
+            result += shard->Count();
+        }
+
+        return (result);
+    }
+
+    bool ResourceMonitor::Info(const uint32_t position, Metadata& info) const
+    {
+        uint32_t offset = position;
+        std::vector<ResourceMonitorBase*>::const_iterator index(_shards.cbegin());
+
+        // Walk the shards, as if it was one list of resources.
+        while ((index != _shards.cend()) && ((*index)->Info(offset, info) == false)) {
+            offset -= std::min(offset, (*index)->Count());
+            index++;
+        }
+
+        return (index != _shards.cend());
+    }
+
+    void ResourceMonitor::Break()
+    {
+        for (ResourceMonitorBase* shard : _shards) {
+            // Only shards that ever monitored something, have a thread to wake up.
+            if (shard->Id() != 0) {
+                shard->Break();
+            }
+        }
+    }
+
     /* static */ ResourceMonitor& ResourceMonitor::Instance()
     {
         // Tests build/destroy the ResourceMonitor for each test. In production the
@@ -7,6 +7,12 @@
 #include "Thread.h"
 #include "Trace.h"
 
+#if defined(RESOURCE_MONITOR_EPOLL) && defined(__LINUX__) && !defined(__APPLE__)
+#define __RESOURCE_MONITOR_EPOLL__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
 namespace WPEFramework {
 
 namespace Core {
@@ -16,6 +22,11 @@ namespace Core {
 
         typedef signed int handle;
 
+        // Resources that always read/write/accept till the descriptor would block, can or this flag
+        // into the Events() result. A monitor that supports it (epoll), will than only report changes
+        // on the descriptor in stead of reporting it every time it is still readable/writable.
+        static constexpr uint16_t EDGE_TRIGGERED = 0x4000;
+
         virtual handle Descriptor() const = 0;
         virtual uint16_t Events() = 0;
         virtual void Handle(const uint16_t events) = 0;
@@ -25,6 +36,21 @@ namespace Core {
     class ResourceMonitorType {
     private:
         static constexpr uint8_t FileDescriptorAllocation = 32;
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        static constexpr uint8_t EventAllocation = 32;
+
+        struct Entry {
+            RESOURCE* resource;
+            uint64_t id;
+            // The descriptor and the events as they are currently registered in the kernel.
+            int descriptor;
+            uint32_t events;
+            uint16_t fired;
+            uint32_t run;
+            bool alive;
+            bool pending;
+        };
+#endif
 
         typedef ResourceMonitorType<RESOURCE> Parent;
 
@@ -76,27 +102,68 @@ namespace Core {
 
     public:
         ResourceMonitorType()
+            : ResourceMonitorType(_T("Monitor::") + ClassNameOnly(typeid(RESOURCE).name()).Text())
+        {
+        }
+        ResourceMonitorType(const string& name)
             : _monitor(nullptr)
             , _adminLock()
             , _resourceList()
             , _monitorRuns(0)
             , _watchDog()
-            , _name(_T("Monitor::") + ClassNameOnly(typeid(RESOURCE).name()).Text())
+            , _name(name)
 #ifdef __WINDOWS__
             , _action(WSACreateEvent())
 #else
             , _descriptorArrayLength(FileDescriptorAllocation)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (_descriptorArrayLength + 1))))
             , _signalDescriptor(-1)
+#endif
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            , _epollDescriptor(-1)
+            , _eventDescriptor(-1)
+            , _triggerLock()
+            , _triggered()
+            , _rescan(false)
+            , _entries()
+            , _ids()
+            , _pending()
+            , _attention()
+            , _dead()
+            , _alive(0)
+            , _nextId(0)
 #endif
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            // The epoll backend is the default if it is build in, but it can be switched off on
+            // the box by setting RESOURCE_MONITOR=poll in the environment.
+            const char* selection = ::getenv("RESOURCE_MONITOR");
+
+            if ((selection == nullptr) || (::strcmp(selection, "poll") != 0)) {
+                _epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC);
+
+                if (_epollDescriptor == -1) {
+                    TRACE_L1("Could not create an epoll descriptor, falling back to poll. Error %d", errno);
+                } else if ((_eventDescriptor = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == -1) {
+                    TRACE_L1("Could not create an event descriptor, falling back to poll. Error %d", errno);
+                    ::close(_epollDescriptor);
+                    _epollDescriptor = -1;
+                } else {
+                    // The data of the event descriptor is 0, all resources have an id > 0.
+                    struct epoll_event event;
+                    event.events = EPOLLIN;
+                    event.data.u64 = 0;
+                    ::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, _eventDescriptor, &event);
+                }
+            }
+#endif
         }
 
         ~ResourceMonitorType()
         {
 
             // All resources should be gone !!!
-            ASSERT(_resourceList.size() == 0);
+            ASSERT(Count() == 0);
 
             if (_monitor != nullptr) {
 
@@ -107,12 +174,23 @@ namespace Core {
                 _adminLock.Lock();
 
                 _resourceList.clear();
+#ifdef __RESOURCE_MONITOR_EPOLL__
+                _entries.clear();
+                _ids.clear();
+#endif
 
                 _adminLock.Unlock();
 
                 delete _monitor;
             }
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                ::close(_eventDescriptor);
+                ::close(_epollDescriptor);
+            }
+#endif
+
 #ifdef __LINUX__
             ::free(_descriptorArray);
             if (_signalDescriptor != -1) {
@@ -139,6 +217,11 @@ namespace Core {
         }
         uint32_t Count() const 
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                return (_alive);
+            }
+#endif
             return (static_cast<uint32_t>(_resourceList.size()));
         }
         bool Info (const uint32_t position, Metadata& info) const
@@ -147,6 +230,32 @@ namespace Core {
 
             _adminLock.Lock();
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                typename std::unordered_map<const RESOURCE*, Entry>::const_iterator index(_entries.cbegin());
+
+                while ((index != _entries.cend()) && ((index->second.alive == false) || (count != 0))) {
+                    if (index->second.alive == true) {
+                        count--;
+                    }
+                    index++;
+                }
+
+                bool found = (index != _entries.cend());
+
+                if (found == true) {
+                    info.descriptor = index->second.descriptor;
+                    info.classname = typeid(*(index->second.resource)).name();
+                    info.monitor = static_cast<uint16_t>(index->second.events);
+                    info.events = index->second.fired;
+                }
+
+                _adminLock.Unlock();
+
+                return (found);
+            }
+#endif
+
             typename std::list<RESOURCE*>::const_iterator index(_resourceList.cbegin());
             while ( (count != 0) && (index != _resourceList.cend()) ) { count--; index++; }
 
@@ -174,6 +283,16 @@ namespace Core {
         {
             _adminLock.Lock();
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                Enlist(resource);
+
+                _adminLock.Unlock();
+
+                return;
+            }
+#endif
+
             // Make sure this entry does not exist, only register resources once !!!
             ASSERT(std::find(_resourceList.begin(), _resourceList.end(), &resource) == _resourceList.end());
 
@@ -198,6 +317,21 @@ namespace Core {
         {
             _adminLock.Lock();
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                typename std::unordered_map<const RESOURCE*, Entry>::iterator index(_entries.find(&resource));
+
+                if ((index != _entries.end()) && (index->second.alive == true)) {
+                    Delist(index->second);
+                    Wakeup();
+                }
+
+                _adminLock.Unlock();
+
+                return;
+            }
+#endif
+
             // Make sure this entry does not exist, only register resources once !!!
             typename std::list<RESOURCE*>::iterator index(std::find(_resourceList.begin(), _resourceList.end(), &resource));
 
@@ -212,11 +346,23 @@ namespace Core {
 
             _adminLock.Unlock();
         }
+        // Wakeup the monitor and have it reevaluate the Events() of all resources.
         inline void Break()
         {
 
             ASSERT(_monitor != nullptr);
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                _triggerLock.Lock();
+                _rescan = true;
+                _triggerLock.Unlock();
+
+                Wakeup();
+                return;
+            }
+#endif
+
 #ifdef __APPLE__
             int data = 0;
             ::sendto(_signalDescriptor
@@ -230,6 +376,22 @@ namespace Core {
             ::WSASetEvent(_action);
 #endif
         };
+        // Wakeup the monitor and have it only reevaluate the Events() of the given resource.
+        // The resource is only used as a key, it is allowed to be unregistered in the mean time.
+        inline void Break(RESOURCE& resource VARIABLE_IS_NOT_USED)
+        {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                _triggerLock.Lock();
+                _triggered.push_back(&resource);
+                _triggerLock.Unlock();
+
+                Wakeup();
+                return;
+            }
+#endif
+            Break();
+        }
 
     private:
         HAS_MEMBER(Arm, hasArm);
@@ -265,6 +427,12 @@ namespace Core {
 #ifdef __LINUX__
         bool Initialize()
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                // Break() goes through the event descriptor, no need to catch signals.
+                return (true);
+            }
+#endif
 #ifdef __APPLE__
 
             if ((_signalDescriptor = ::socket(AF_UNIX, SOCK_DGRAM, 0)) == -1) {
@@ -311,9 +479,269 @@ namespace Core {
         }
 #endif
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        inline void Wakeup()
+        {
+            uint64_t value = 1;
+            ssize_t VARIABLE_IS_NOT_USED result = ::write(_eventDescriptor, &value, sizeof(value));
+        }
+        void Enlist(RESOURCE& resource)
+        {
+            typename std::unordered_map<const RESOURCE*, Entry>::iterator index(_entries.find(&resource));
+
+            if (index == _entries.end()) {
+                Entry entry;
+                entry.resource = &resource;
+                entry.id = ++_nextId;
+                entry.descriptor = -1;
+                entry.events = 0;
+                entry.fired = 0;
+                entry.run = 0;
+                entry.alive = true;
+                entry.pending = false;
+
+                index = _entries.emplace(&resource, entry).first;
+                _ids.emplace(entry.id, &resource);
+            } else {
+                // Make sure this entry is not active, only register resources once !!!
+                ASSERT(index->second.alive == false);
+
+                // It was unregistered but not yet cleaned up, revive it.
+                index->second.alive = true;
+            }
+
+            Pending(index->second);
+
+            _alive++;
+
+            if (_alive == 1) {
+                if (_monitor == nullptr) {
+                    _monitor = new MonitorWorker(*this);
+
+                    // Wait till we are at least initialized
+                    _monitor->Wait(Thread::BLOCKED | Thread::STOPPED);
+                }
+
+                _monitor->Run();
+            } else {
+                Wakeup();
+            }
+        }
+        void Delist(Entry& entry)
+        {
+            ASSERT(entry.alive == true);
+
+            // Take it out of the kernel right away, the descriptor might be closed after this.
+            // The memory is kept till the start of the next run, as the event reported by the
+            // kernel might still be on its way.
+            if (entry.descriptor != -1) {
+                ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.descriptor, nullptr);
+                entry.descriptor = -1;
+                entry.events = 0;
+            }
+
+            entry.alive = false;
+            _alive--;
+            _dead.push_back(entry.resource);
+        }
+        inline void Pending(Entry& entry)
+        {
+            if (entry.pending == false) {
+                entry.pending = true;
+                _pending.push_back(entry.resource);
+            }
+        }
+        void Evaluate(Entry& entry)
+        {
+            uint16_t events = entry.resource->Events();
+
+            if (events == 0) {
+                Delist(entry);
+            } else {
+                int descriptor = entry.resource->Descriptor();
+                uint32_t mask = (events & ~IResource::EDGE_TRIGGERED) | ((events & IResource::EDGE_TRIGGERED) != 0 ? static_cast<uint32_t>(EPOLLET) : 0);
+
+                if (descriptor != entry.descriptor) {
+                    if (entry.descriptor != -1) {
+                        ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.descriptor, nullptr);
+                    }
+                    entry.descriptor = -1;
+                    entry.events = 0;
+                }
+
+                if (mask != entry.events) {
+                    struct epoll_event event;
+                    event.events = mask;
+                    event.data.u64 = entry.id;
+
+                    // If the descriptor was closed and the number reused, the kernel already forgot about
+                    // it, in that case the modification fails and we need to add it again.
+                    if ((entry.descriptor == -1) || (::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, descriptor, &event) != 0)) {
+                        if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, descriptor, &event) != 0) {
+                            TRACE_L1("Could not add descriptor %d to the epoll set. Error %d", descriptor, errno);
+                        }
+                    }
+
+                    entry.descriptor = descriptor;
+                    entry.events = mask;
+                }
+            }
+        }
+        inline void Dispatch(Entry& entry, const uint16_t flagsSet)
+        {
+            entry.run = _monitorRuns;
+
+            Arm<WATCHDOG>();
+
+            entry.resource->Handle(flagsSet);
+
+            Reset<WATCHDOG>();
+
+            // The handling might have changed what the resource is interested in, or it might even
+            // have unregistered itself..
+            if (entry.alive == true) {
+                Evaluate(entry);
+            }
+        }
+        uint32_t EventWorker()
+        {
+            std::list<RESOURCE*> triggered;
+            bool rescan;
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _triggerLock.Lock();
+            triggered.swap(_triggered);
+            rescan = _rescan;
+            _rescan = false;
+            _triggerLock.Unlock();
+
+            _adminLock.Lock();
+
+            // Now it is safe to forget the entries that were unregistered during the previous run.
+            for (const RESOURCE* resource : _dead) {
+                typename std::unordered_map<const RESOURCE*, Entry>::iterator index(_entries.find(resource));
+
+                if ((index != _entries.end()) && (index->second.alive == false)) {
+                    _ids.erase(index->second.id);
+                    _entries.erase(index);
+                }
+            }
+            _dead.clear();
+
+            if (rescan == true) {
+                for (std::pair<const RESOURCE* const, Entry>& entry : _entries) {
+                    if (entry.second.alive == true) {
+                        Pending(entry.second);
+                    }
+                }
+            } else {
+                for (const RESOURCE* resource : triggered) {
+                    typename std::unordered_map<const RESOURCE*, Entry>::iterator index(_entries.find(resource));
+
+                    if ((index != _entries.end()) && (index->second.alive == true)) {
+                        Pending(index->second);
+                    }
+                }
+            }
+
+            // Only the resources that were registered or triggered need to be (re)evaluated. Even if
+            // they do not fire, they get a Handle(0), maybe a break was issued by this RESOURCE..
+            _attention.clear();
+
+            for (RESOURCE* resource : _pending) {
+                typename std::unordered_map<const RESOURCE*, Entry>::iterator index(_entries.find(resource));
+
+                // It might have been unregistered and cleaned up before it was picked up.
+                if (index != _entries.end()) {
+                    Entry& entry(index->second);
+
+                    entry.pending = false;
+
+                    if (entry.alive == true) {
+                        Evaluate(entry);
+
+                        if (entry.alive == true) {
+                            _attention.push_back(entry.id);
+                        }
+                    }
+                }
+            }
+            _pending.clear();
+
+            if (_alive > 0) {
+                struct epoll_event events[EventAllocation];
+
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_epollDescriptor, events, EventAllocation, (_attention.empty() == true ? -1 : 0));
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    if (errno != EINTR) {
+                        TRACE_L1("epoll_wait failed with error <%d>", errno);
+                    }
+                    result = 0;
+                }
+
+                for (int teller = 0; teller < result; teller++) {
+                    if (events[teller].data.u64 == 0) {
+                        uint64_t value;
+                        ssize_t VARIABLE_IS_NOT_USED bytes = ::read(_eventDescriptor, &value, sizeof(value));
+                    } else {
+                        Entry* entry = Find(events[teller].data.u64);
+
+                        // The entry might have been removed from observing in the mean time...
+                        if (entry != nullptr) {
+                            entry->fired = static_cast<uint16_t>(events[teller].events);
+                            Dispatch(*entry, entry->fired);
+                        }
+                    }
+                }
+
+                for (const uint64_t id : _attention) {
+                    Entry* entry = Find(id);
+
+                    if ((entry != nullptr) && (entry->run != _monitorRuns)) {
+                        Dispatch(*entry, 0);
+                    }
+                }
+            } else {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+
+            _adminLock.Unlock();
+
+            return (delay);
+        }
+        inline Entry* Find(const uint64_t id)
+        {
+            Entry* result = nullptr;
+            typename std::unordered_map<uint64_t, const RESOURCE*>::const_iterator index(_ids.find(id));
+
+            if (index != _ids.cend()) {
+                Entry& entry(_entries.find(index->second)->second);
+
+                if (entry.alive == true) {
+                    result = &entry;
+                }
+            }
+
+            return (result);
+        }
+#endif
+
 #ifdef __LINUX__
         uint32_t Worker()
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                return (EventWorker());
+            }
+#endif
             uint32_t delay = 0;
 
             _monitorRuns++;
@@ -348,7 +776,7 @@ namespace Core {
                     index = _resourceList.erase(index);
                 } else {
                     _descriptorArray[filledFileDescriptors].fd = entry->Descriptor();
-                    _descriptorArray[filledFileDescriptors].events = events;
+                    _descriptorArray[filledFileDescriptors].events = (events & ~IResource::EDGE_TRIGGERED);
                     _descriptorArray[filledFileDescriptors].revents = 0;
                     filledFileDescriptors++;
                     index++;
@@ -513,6 +941,20 @@ namespace Core {
 #endif
 #ifdef __APPLE__
         Core::NodeId _signalNode;
+#endif
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        int _epollDescriptor;
+        int _eventDescriptor;
+        Core::CriticalSection _triggerLock;
+        std::list<RESOURCE*> _triggered;
+        bool _rescan;
+        std::unordered_map<const RESOURCE*, Entry> _entries;
+        std::unordered_map<uint64_t, const RESOURCE*> _ids;
+        std::list<RESOURCE*> _pending;
+        std::list<uint64_t> _attention;
+        std::list<const RESOURCE*> _dead;
+        uint32_t _alive;
+        uint64_t _nextId;
 #endif
     };
 
@@ -543,20 +985,70 @@ namespace Core {
     typedef ResourceMonitorType<IResource> ResourceMonitorBase;
 #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor can run multiple monitor threads (shards), each owning a part of the resources.
+    // A resource is assigned to a shard based on its address, so it always lands on the same shard
+    // without any administration. The number of shards is RESOURCE_MONITOR_SHARDS (build time, default 1)
+    // and can be overruled by the RESOURCE_MONITOR_SHARDS environment variable.
+    // Note that with more than one shard, Handle() calls of different resources run concurrently.
+    class EXTERNAL ResourceMonitor {
     private:
-        ResourceMonitor()
-            : ResourceMonitorBase()
-        {
-        }
+        ResourceMonitor();
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(const ResourceMonitor&) = delete;
 
         friend class SingletonType<ResourceMonitor>;
 
+    public:
+        typedef ResourceMonitorBase::Metadata Metadata;
+
     public:
         static ResourceMonitor& Instance();
-        ~ResourceMonitor() {}
+        ~ResourceMonitor();
+
+    public:
+        inline uint8_t Shards() const
+        {
+            return (static_cast<uint8_t>(_shards.size()));
+        }
+        inline ::ThreadId Id() const
+        {
+            return (_shards[0]->Id());
+        }
+        inline ::ThreadId Id(const uint8_t shard) const
+        {
+            ASSERT(shard < _shards.size());
+
+            return (_shards[shard]->Id());
+        }
+        inline void Register(IResource& resource)
+        {
+            Shard(resource).Register(resource);
+        }
+        inline void Unregister(IResource& resource)
+        {
+            Shard(resource).Unregister(resource);
+        }
+        inline void Break(IResource& resource)
+        {
+            Shard(resource).Break(resource);
+        }
+        bool IsMonitor(const ::ThreadId id) const;
+        uint32_t Runs() const;
+        uint32_t Count() const;
+        bool Info(const uint32_t position, Metadata& info) const;
+        void Break();
+
+    private:
+        inline ResourceMonitorBase& Shard(const IResource& resource)
+        {
+            // Objects are at least pointer aligned, mix the address bits so all shards get used.
+            uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&resource)) * 0x9E3779B97F4A7C15ULL;
+
+            return (*(_shards[static_cast<uint8_t>((hash >> 32) % _shards.size())]));
+        }
+
+    private:
+        std::vector<ResourceMonitorBase*> _shards;
     };
 }
 } // namespace WPEFramework::Core
@@ -10,6 +10,7 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <net/if.h>
+#include <sys/uio.h>
 #define __ERRORRESULT__ errno
 #define __ERROR_AGAIN__ EAGAIN
 #define __ERROR_WOULDBLOCK__ EWOULDBLOCK
@@ -134,6 +135,15 @@ namespace Core {
         socket = INVALID_SOCKET;
     }
 
+#ifdef __LINUX__
+    // The batched datagram ring is one allocation: the Datagram slots (receive and send), followed by
+    // their system call headers and io vectors, followed by the data of all slots.
+    inline struct mmsghdr* BatchHeaders(SocketPort::Datagram batch[], const uint8_t slots)
+    {
+        return (reinterpret_cast<struct mmsghdr*>(&batch[2 * slots]));
+    }
+#endif
+
     bool SetNonBlocking(SOCKET socket)
     {
 #ifdef __WINDOWS__
@@ -182,6 +192,15 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_ReadBytes(0)
+        , m_SendBytes(0)
+        , m_SendOffset(0)
+        , m_SliceCount(0)
+        , m_SliceIndex(0)
+        , m_BatchSlots(0)
+        , m_BatchLoaded(0)
+        , m_BatchSent(0)
+        , m_Batch(nullptr)
     {
         TRACE_L5("Constructor SocketPort (NodeId&) <%p>", (this));
     }
@@ -203,6 +222,15 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_ReadBytes(0)
+        , m_SendBytes(0)
+        , m_SendOffset(0)
+        , m_SliceCount(0)
+        , m_SliceIndex(0)
+        , m_BatchSlots(0)
+        , m_BatchLoaded(0)
+        , m_BatchSent(0)
+        , m_Batch(nullptr)
     {
         NodeId::SocketInfo localAddress;
         socklen_t localSize = sizeof(localAddress);
@@ -231,6 +259,7 @@ namespace Core {
         ASSERT(m_Socket == INVALID_SOCKET);
 
         ::free(m_SendBuffer);
+        ::free(m_Batch);
     }
 
     //////////////////////////////////////////////////////////////////////
@@ -293,6 +322,10 @@ namespace Core {
         m_ReadBytes = 0;
         m_SendBytes = 0;
         m_SendOffset = 0;
+        m_SliceCount = 0;
+        m_SliceIndex = 0;
+        m_BatchLoaded = 0;
+        m_BatchSent = 0;
 
         if ((m_State & (SocketPort::LINK | SocketPort::OPEN | SocketPort::MONITOR)) == (SocketPort::LINK | SocketPort::OPEN)) {
             // Open up an accepted socket, but not yet added to the monitor.
@@ -401,7 +434,7 @@ namespace Core {
 #endif
                 }
 
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Break(*this);
             }
 
             if (waitTime > 0) {
@@ -413,7 +446,7 @@ namespace Core {
 
                     // We probably did not get a response from the otherside on the close
                     // sloppy but let's forcefully close it
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Break(*this);
 
                     closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -434,11 +467,80 @@ namespace Core {
         if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
             m_State |= SocketPort::WRITESLOT;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Break(*this);
         }
         m_syncAdmin.Unlock();
     }
 
+    bool SocketPort::Batch(const uint8_t slots VARIABLE_IS_NOT_USED)
+    {
+        bool result = false;
+
+        ASSERT(m_SocketType == SocketPort::DATAGRAM);
+        ASSERT((m_Socket == INVALID_SOCKET) && (m_Batch == nullptr));
+
+#ifdef __LINUX__
+        if ((slots > 1) && (m_SocketType == SocketPort::DATAGRAM) && (m_Socket == INVALID_SOCKET) && (m_Batch == nullptr)) {
+            const uint16_t entries = 2 * slots;
+            const uint32_t administration = entries * (sizeof(Datagram) + sizeof(struct mmsghdr) + sizeof(struct iovec));
+            uint8_t* memory = static_cast<uint8_t*>(::malloc(administration + (slots * (static_cast<uint32_t>(m_ReceiveBufferSize) + m_SendBufferSize))));
+
+            ::memset(memory, 0, administration);
+
+            m_Batch = reinterpret_cast<Datagram*>(memory);
+
+            struct mmsghdr* headers = BatchHeaders(m_Batch, slots);
+            struct iovec* vectors = reinterpret_cast<struct iovec*>(&headers[entries]);
+            uint8_t* data = &memory[administration];
+
+            // The first half of the slots receives, the second half sends.
+            for (uint16_t index = 0; index < entries; index++) {
+                const uint16_t size = (index < slots ? m_ReceiveBufferSize : m_SendBufferSize);
+
+                m_Batch[index].Buffer = data;
+                vectors[index].iov_base = data;
+                vectors[index].iov_len = size;
+                headers[index].msg_hdr.msg_iov = &vectors[index];
+                headers[index].msg_hdr.msg_iovlen = 1;
+                headers[index].msg_hdr.msg_name = &(m_Batch[index].Remote);
+                data += size;
+            }
+
+            m_BatchSlots = slots;
+            result = true;
+        }
+#endif
+
+        return (result);
+    }
+
+    /* virtual */ void SocketPort::ReceiveBatch(Datagram datagrams[], const uint16_t count)
+    {
+        for (uint16_t index = 0; index < count; index++) {
+            Datagram& datagram(datagrams[index]);
+            uint16_t offset = 0;
+
+            if (datagram.Remote.IPV4Socket.sin_family != AF_UNSPEC) {
+                m_ReceivedNode = datagram.Remote;
+            }
+
+            // Just like the unbatched Read, whatever is not consumed is offered again, till nothing
+            // is left or the subclass does not take anything anymore.
+            while (offset < datagram.Size) {
+                uint16_t handledBytes = ReceiveData(&(datagram.Buffer[offset]), datagram.Size - offset);
+
+                ASSERT(handledBytes <= (datagram.Size - offset));
+
+                if (handledBytes == 0) {
+                    TRACE_L1("Dropped %d bytes of a batched datagram, they were not consumed.", datagram.Size - offset);
+                    break;
+                }
+
+                offset += handledBytes;
+            }
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////
     // PRIVATE SocketPort interface
     //////////////////////////////////////////////////////////////////////
@@ -600,7 +702,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsOpen() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -635,7 +737,7 @@ namespace Core {
                 break;
             }
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -664,7 +766,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsClosed() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -725,6 +827,11 @@ namespace Core {
                 }
 #ifdef __LINUX__
                 result |= ((m_State & SocketPort::LINK) != 0 ? POLLHUP : 0) | ((m_State & SocketPort::WRITE) != 0 ? POLLOUT : 0);
+
+                // Once open, Read() and Write() continue till the socket would block, so we only need to hear about changes.
+                if (IsOpen() == true) {
+                    result |= IResource::EDGE_TRIGGERED;
+                }
 #endif
             }
         }
@@ -783,22 +890,35 @@ namespace Core {
 
     void SocketPort::Write()
     {
-        bool dataLeftToSend = true;
+        bool dataLeftToSend = (m_BatchSlots == 0);
 
         m_syncAdmin.Lock();
 
         m_State &= (~(SocketPort::WRITE | SocketPort::WRITESLOT));
 
+        if (m_BatchSlots != 0) {
+            WriteBatch();
+        }
+
         while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
-            if (m_SendOffset == m_SendBytes) {
-                m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
-                m_SendOffset = 0;
-                dataLeftToSend = (m_SendOffset != m_SendBytes);
+            if ((m_SendOffset == m_SendBytes) && (m_SliceCount == 0)) {
+                m_SliceCount = Gather(m_Slices, GatherSlices);
+                m_SliceIndex = 0;
+
+                ASSERT(m_SliceCount <= GatherSlices);
+
+                if (m_SliceCount == 0) {
+                    m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
+                    m_SendOffset = 0;
+                    dataLeftToSend = (m_SendOffset != m_SendBytes);
 
-                ASSERT(m_SendBytes <= m_SendBufferSize);
+                    ASSERT(m_SendBytes <= m_SendBufferSize);
+                }
             }
 
-            if (dataLeftToSend == true) {
+            if (m_SliceCount != 0) {
+                WriteSlices();
+            } else if (dataLeftToSend == true) {
                 int32_t sendSize;
 
                 // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
@@ -837,13 +957,212 @@ namespace Core {
         m_syncAdmin.Unlock();
     }
 
+    // Write what is left of the gathered slices, with the lock taken.
+    void SocketPort::WriteSlices()
+    {
+        const bool datagram = (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true));
+        uint16_t count = 0;
+        uint32_t total = 0;
+
+#ifdef __WINDOWS__
+        WSABUF vector[GatherSlices];
+
+        for (uint16_t index = m_SliceIndex; index < m_SliceCount; index++) {
+            if (m_Slices[index].Size != 0) {
+                vector[count].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(m_Slices[index].Buffer));
+                vector[count].len = m_Slices[index].Size;
+                total += m_Slices[index].Size;
+                count++;
+            }
+        }
+
+        int32_t sendSize = 0;
+
+        if (count != 0) {
+            DWORD sent = 0;
+            int result;
+
+            if (datagram == true) {
+                result = ::WSASendTo(m_Socket, vector, count, &sent, 0, static_cast<const NodeId&>(m_RemoteNode), m_RemoteNode.Size(), nullptr, nullptr);
+            } else {
+                result = ::WSASend(m_Socket, vector, count, &sent, 0, nullptr, nullptr);
+            }
+
+            sendSize = (result == 0 ? static_cast<int32_t>(sent) : SOCKET_ERROR);
+        }
+#else
+        struct iovec vector[GatherSlices];
+
+        for (uint16_t index = m_SliceIndex; index < m_SliceCount; index++) {
+            if (m_Slices[index].Size != 0) {
+                vector[count].iov_base = const_cast<uint8_t*>(m_Slices[index].Buffer);
+                vector[count].iov_len = m_Slices[index].Size;
+                total += m_Slices[index].Size;
+                count++;
+            }
+        }
+
+        ssize_t sendSize = 0;
+
+        if (count != 0) {
+            struct msghdr message;
+
+            ::memset(&message, 0, sizeof(message));
+            message.msg_iov = vector;
+            message.msg_iovlen = count;
+
+            if (datagram == true) {
+                message.msg_name = const_cast<struct sockaddr*>(static_cast<const struct sockaddr*>(static_cast<const NodeId&>(m_RemoteNode)));
+                message.msg_namelen = m_RemoteNode.Size();
+            }
+
+            sendSize = ::sendmsg(m_Socket, &message, 0);
+        }
+#endif
+
+        if (sendSize >= 0) {
+            // Datagrams go as a whole, on a link it might be partially sent.
+            uint32_t sent = ((m_State & SocketPort::LINK) != 0 ? static_cast<uint32_t>(sendSize) : total);
+
+            while ((m_SliceIndex < m_SliceCount) && (sent >= m_Slices[m_SliceIndex].Size)) {
+                sent -= m_Slices[m_SliceIndex].Size;
+                m_SliceIndex++;
+            }
+            if (m_SliceIndex < m_SliceCount) {
+                m_Slices[m_SliceIndex].Buffer += sent;
+                m_Slices[m_SliceIndex].Size -= sent;
+            } else {
+                ReleaseSlices();
+            }
+        } else {
+            uint32_t l_Result = __ERRORRESULT__;
+
+            if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
+                m_State |= SocketPort::WRITE;
+            } else {
+                printf("Write exception. %d\n", l_Result);
+                m_State |= SocketPort::EXCEPTION;
+                StateChange();
+            }
+        }
+    }
+
+    // Collect a datagram per send slot through SendData and write them all with one system call, with the lock taken.
+    void SocketPort::WriteBatch()
+    {
+#ifdef __LINUX__
+        Datagram* slots = &m_Batch[m_BatchSlots];
+        struct mmsghdr* headers = &(BatchHeaders(m_Batch, m_BatchSlots)[m_BatchSlots]);
+        bool dataLeftToSend = true;
+
+        while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
+            if (m_BatchSent == m_BatchLoaded) {
+                m_BatchSent = 0;
+                m_BatchLoaded = 0;
+
+                while (m_BatchLoaded < m_BatchSlots) {
+                    Datagram& slot(slots[m_BatchLoaded]);
+
+                    slot.Size = SendData(slot.Buffer, m_SendBufferSize);
+
+                    if (slot.Size == 0) {
+                        break;
+                    }
+
+                    ASSERT(slot.Size <= m_SendBufferSize);
+
+                    // SendData might have picked another destination, every datagram keeps its own.
+                    if (m_RemoteNode.IsValid() == true) {
+                        slot.Remote = static_cast<const NodeId::SocketInfo&>(m_RemoteNode);
+                        headers[m_BatchLoaded].msg_hdr.msg_name = &(slot.Remote);
+                        headers[m_BatchLoaded].msg_hdr.msg_namelen = m_RemoteNode.Size();
+                    } else {
+                        headers[m_BatchLoaded].msg_hdr.msg_name = nullptr;
+                        headers[m_BatchLoaded].msg_hdr.msg_namelen = 0;
+                    }
+                    headers[m_BatchLoaded].msg_hdr.msg_iov->iov_len = slot.Size;
+                    m_BatchLoaded++;
+                }
+
+                dataLeftToSend = (m_BatchLoaded != 0);
+            }
+
+            if (dataLeftToSend == true) {
+                int sent = ::sendmmsg(m_Socket, &headers[m_BatchSent], m_BatchLoaded - m_BatchSent, 0);
+
+                if (sent >= 0) {
+                    m_BatchSent += static_cast<uint8_t>(sent);
+                } else {
+                    uint32_t l_Result = __ERRORRESULT__;
+
+                    if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
+                        m_State |= SocketPort::WRITE;
+                    } else {
+                        printf("Write exception. %d\n", l_Result);
+                        m_State |= SocketPort::EXCEPTION;
+                        StateChange();
+                    }
+                }
+            }
+        }
+#endif
+    }
+
+    // Read up to a datagram per receive slot with one system call and offer them all at once, with the lock taken.
+    void SocketPort::ReadBatch()
+    {
+#ifdef __LINUX__
+        struct mmsghdr* headers = BatchHeaders(m_Batch, m_BatchSlots);
+
+        // Like the unbatched Read, the sender is only reported for unconnected, none netlink sockets.
+        const bool named = (((m_State & SocketPort::LINK) == 0) && (m_LocalNode.Type() != NodeId::TYPE_NETLINK));
+
+        while ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN) {
+            for (uint8_t index = 0; index < m_BatchSlots; index++) {
+                headers[index].msg_hdr.msg_name = (named == true ? &(m_Batch[index].Remote) : nullptr);
+                headers[index].msg_hdr.msg_namelen = (named == true ? sizeof(NodeId::SocketInfo) : 0);
+            }
+
+            int count = ::recvmmsg(m_Socket, headers, m_BatchSlots, 0, nullptr);
+
+            if (count > 0) {
+                for (int index = 0; index < count; index++) {
+                    m_Batch[index].Size = static_cast<uint16_t>(headers[index].msg_len);
+
+                    if (headers[index].msg_hdr.msg_namelen == 0) {
+                        m_Batch[index].Remote.IPV4Socket.sin_family = AF_UNSPEC;
+                    }
+                }
+
+                ReceiveBatch(m_Batch, static_cast<uint16_t>(count));
+            } else {
+                uint32_t l_Result = __ERRORRESULT__;
+
+                if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__) || (l_Result == 0)) {
+                    m_State |= SocketPort::READ;
+                } else if (l_Result == __ERROR_CONNRESET__) {
+                    m_State = ((m_State & (~SocketPort::OPEN)) | SocketPort::EXCEPTION);
+                } else {
+                    m_State |= SocketPort::EXCEPTION;
+                    StateChange();
+                    printf("Read exception. %d\n", l_Result);
+                }
+            }
+        }
+#endif
+    }
+
     void SocketPort::Read()
     {
         m_syncAdmin.Lock();
 
         m_State &= (~SocketPort::READ);
 
-        while ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN) {
+        if (m_BatchSlots != 0) {
+            ReadBatch();
+        }
+
+        while ((m_BatchSlots == 0) && ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN)) {
             uint32_t l_Size;
 
             if (m_ReadBytes == m_ReceiveBufferSize) {
@@ -924,6 +1243,9 @@ namespace Core {
         if (m_State != 0) {
             result = false;
         } else {
+            // Whatever was handed out to be sent, will not be sent anymore.
+            ReleaseSlices();
+
             DestroySocket(m_Socket);
             // Remove socket descriptor for UNIX domain datagram socket.
             if ((m_LocalNode.Type() == NodeId::TYPE_DOMAIN) && ((m_SocketType == SocketPort::LISTEN) || (SocketMode() != SOCK_STREAM))) {
@@ -62,6 +62,22 @@ namespace Core {
 
         } enumType;
 
+        // A reference to data, owned by the subclass, that can be send without copying it, see Gather().
+        struct Slice {
+            const uint8_t* Buffer;
+            uint32_t Size;
+        };
+
+        static constexpr uint8_t GatherSlices = 16;
+
+        // A slot of the batched datagram ring, see Batch(). Remote holds the sender (receive) or the
+        // destination (send) of the datagram.
+        struct Datagram {
+            uint8_t* Buffer;
+            uint16_t Size;
+            NodeId::SocketInfo Remote;
+        };
+
     public:
         SocketPort(const enumType socketType,
             const NodeId& localNode,
@@ -168,6 +184,9 @@ namespace Core {
             m_ReadBytes = 0;
             m_SendBytes = 0;
             m_SendOffset = 0;
+            m_BatchLoaded = 0;
+            m_BatchSent = 0;
+            ReleaseSlices();
             m_syncAdmin.Unlock();
         }
 
@@ -188,10 +207,36 @@ namespace Core {
         uint32_t Close(const uint32_t waitTime);
         void Trigger();
 
+        // Datagram sockets only, to be called before the socket is opened. Reads and writes up to slots
+        // datagrams per system call (recvmmsg/sendmmsg) instead of one. Each slot is as big as the send
+        // and receive buffer. Returns false if this platform can not batch, the socket is left unchanged.
+        bool Batch(const uint8_t slots);
+
         // Methods to extract and insert data into the socket buffers
         virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
         virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
 
+        // Scatter/gather alternative for SendData. Before the send buffer is filled through SendData, the
+        // subclass gets a chance to hand out up to maxSlices references to its own data (e.g. a header and
+        // a body). These are written as is (writev/sendmsg), so no copy and no limit of the send buffer size.
+        // On datagram sockets, all slices together form one datagram. The data must stay untouched till
+        // Gathered() is called. Return 0 to have the data collected through SendData.
+        virtual uint16_t Gather(Slice /* slices */[], const uint16_t /* maxSlices */)
+        {
+            return (0);
+        }
+        // All data handed out with the last Gather() is sent (or the socket has been flushed/closed).
+        virtual void Gathered()
+        {
+        }
+
+        // In batched mode, all datagrams read with one system call are offered here. By default they are
+        // passed on, one by one, to ReceiveData with the ReceivedNode() set to their sender (if the socket
+        // reports one, so not for netlink or connected sockets). What is not consumed from a datagram is
+        // offered again; once ReceiveData takes nothing of it anymore, the rest is dropped (and traced).
+        // A Remote with family AF_UNSPEC has no sender.
+        virtual void ReceiveBatch(Datagram datagrams[], const uint16_t count);
+
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
 
@@ -223,6 +268,17 @@ namespace Core {
         void Accepted();
         void Read();
         void Write();
+        void WriteSlices();
+        void ReadBatch();
+        void WriteBatch();
+        inline void ReleaseSlices()
+        {
+            if (m_SliceCount != 0) {
+                m_SliceCount = 0;
+                m_SliceIndex = 0;
+                Gathered();
+            }
+        }
         void BufferAlignment(SOCKET socket);
         SOCKET ConstructSocket(NodeId& localNode, const string& interfaceName);
         uint32_t WaitForOpen(const uint32_t time) const;
@@ -244,6 +300,13 @@ namespace Core {
         uint16_t m_ReadBytes;
         uint16_t m_SendBytes;
         uint16_t m_SendOffset;
+        Slice m_Slices[GatherSlices];
+        uint16_t m_SliceCount;
+        uint16_t m_SliceIndex;
+        uint8_t m_BatchSlots;
+        uint8_t m_BatchLoaded;
+        uint8_t m_BatchSent;
+        Datagram* m_Batch;
     };
 
     class EXTERNAL SocketStream : public SocketPort {
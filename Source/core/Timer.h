@@ -134,13 +134,32 @@ namespace Core {
         typedef TimedInfo<CONTENT> TimeInfoBlocks;
         typedef typename std::list<TimeInfoBlocks> SubscriberList;
 
+        // The pending timers are kept in a hierarchical timing wheel, with a resolution of a millisecond.
+        // Level 0 holds the timers that expire in the current block of WheelSize ms, level 1 the ones that
+        // expire in the current block of WheelSize^2 ms, etc. Timers beyond the last level are kept in an
+        // overflow list. Once the time reaches the start of a slot on a higher level, the timers in that
+        // slot are cascaded to the lower levels. This makes Schedule() O(1) and all timers that expire
+        // in the same millisecond are handled in one go.
+        static constexpr uint8_t WheelBits = 6;
+        static constexpr uint32_t WheelSize = (1 << WheelBits);
+        static constexpr uint32_t WheelMask = (WheelSize - 1);
+        static constexpr uint8_t WheelLevels = 4;
+
     public:
         TimerType(const uint32_t stackSize, const TCHAR* timerName)
-            : m_PendingQueue()
+            : m_Overflow()
+            , m_Expired()
+            , m_Now(Time::Now().Ticks())
+            , m_Current(Tick(m_Now))
+            , m_Pending(0)
             , m_TimerThread(*this, stackSize, timerName)
             , m_Admin()
             , m_NextTrigger(NUMBER_MAX_UNSIGNED(uint64_t))
         {
+            for (uint8_t level = 0; level < WheelLevels; level++) {
+                m_LevelCount[level] = 0;
+            }
+
             // Everything is initialized, go...
             m_TimerThread.Block();
         }
@@ -151,7 +170,16 @@ namespace Core {
             m_TimerThread.Stop();
 
             // Force kill on all pending stuff...
-            m_PendingQueue.clear();
+            for (uint8_t level = 0; level < WheelLevels; level++) {
+                for (uint32_t index = 0; index < WheelSize; index++) {
+                    m_Wheel[level][index].clear();
+                }
+                m_LevelCount[level] = 0;
+            }
+            m_Overflow.clear();
+            m_Expired.clear();
+            m_Pending = 0;
+
             m_Admin.Unlock();
 
             m_TimerThread.Wait(Thread::BLOCKED|Thread::STOPPED, Core::infinite);
@@ -197,15 +225,7 @@ namespace Core {
 
             m_Admin.Lock();
 
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
-
-            while ((index != m_PendingQueue.end()) && ((*index).Content() != info)) {
-                ++index;
-            }
-
-            if (index != m_PendingQueue.end()) {
-                m_PendingQueue.erase(index);
-            }
+            RemoveEntry(info, true);
 
             if (ScheduleEntry(std::move(newEntry)) == true) {
                 m_TimerThread.Run();
@@ -220,16 +240,14 @@ namespace Core {
 
             m_Admin.Lock();
 
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
-
             // Since we have the admin lock, we are pretty sure that there is not any
             // context running, so we can be pretty sure that if it was scheduled, it
             // is gone !!!
-            if (RemoveEntry(index, info) == true) {
+            if (RemoveEntry(info, false) == true) {
 
                 foundElement = true;
 
-                // If we added the new time up front, retrigger the scheduler.
+                // Let the scheduler reevaluate when it needs to wake up.
                 m_TimerThread.Run();
             }
 
@@ -245,7 +263,7 @@ namespace Core {
 
         uint32_t Pending() const
         {
-            return (m_PendingQueue.size());
+            return (m_Pending);
         }
 
         ::ThreadId ThreadId() const
@@ -265,11 +283,14 @@ namespace Core {
             // Ranging from 0-Core::infinite
             m_TimerThread.Block();
 
-            while ((m_PendingQueue.empty() == false) && (m_PendingQueue.front().ScheduleTime() <= now)) {
-                TimedInfo<CONTENT> info(std::move(m_PendingQueue.front()));
+            Expire(now);
+
+            while (m_Expired.empty() == false) {
+                TimedInfo<CONTENT> info(std::move(m_Expired.front()));
 
                 // Make sure we loose the current one before we do the call, that one might add ;-)
-                m_PendingQueue.pop_front();
+                m_Expired.pop_front();
+                m_Pending--;
 
                 m_Admin.Unlock();
 
@@ -283,23 +304,28 @@ namespace Core {
                     info.ScheduleTime(reschedule);
                     ScheduleEntry(std::move(info));
                 }
+
+                // Something scheduled during the call might be due already..
+                Expire(now);
             }
 
             // Calculate the delay...
-            if (m_PendingQueue.empty() == true) {
+            uint64_t next = Earliest();
+
+            if (next == NUMBER_MAX_UNSIGNED(uint64_t)) {
                 m_NextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
                 uint64_t delta = Time::Now().Ticks();
 
-                if (delta >= m_PendingQueue.front().ScheduleTime()) {
+                if (delta >= next) {
                     m_NextTrigger = delta;
                     delayTime = 0;
                 } else {
                     // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
-                    // om de waarde in ms te krijgen.
-                    m_NextTrigger = m_PendingQueue.front().ScheduleTime();
-                    delayTime = static_cast<uint32_t>((m_NextTrigger - delta) / Time::TicksPerMillisecond);
+                    // om de waarde in ms te krijgen. Round up, the wheel has a resolution of a ms anyway.
+                    m_NextTrigger = next;
+                    delayTime = static_cast<uint32_t>((m_NextTrigger - delta + Time::TicksPerMillisecond - 1) / Time::TicksPerMillisecond);
                 }
             }
 
@@ -309,49 +335,230 @@ namespace Core {
         }
 
     private:
+        static inline uint64_t Tick(const uint64_t time)
+        {
+            return (time / Time::TicksPerMillisecond);
+        }
+        // Returns the list the timer, given its schedule time, belongs to, relative to the current tick.
+        SubscriberList& Slot(const uint64_t scheduleTime)
+        {
+            // If it is overdue, there is no need to put it on the wheel.
+            return (scheduleTime <= m_Now ? m_Expired : Wheel(scheduleTime));
+        }
+        SubscriberList& Wheel(const uint64_t scheduleTime)
+        {
+            uint64_t tick = Tick(scheduleTime);
+
+            if (tick < m_Current) {
+                // Due in the tick we just handled, take it with the next tick.
+                tick = m_Current;
+            }
+
+            // The level is determined by the highest block in which the tick differs from the current tick.
+            const uint64_t differ = (tick ^ m_Current);
+            uint8_t level = 0;
+
+            while ((level < WheelLevels) && ((differ >> (WheelBits * (level + 1))) != 0)) {
+                level++;
+            }
+
+            if (level == WheelLevels) {
+                return (m_Overflow);
+            }
+
+            m_LevelCount[level]++;
+
+            return (m_Wheel[level][(tick >> (WheelBits * level)) & WheelMask]);
+        }
         bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
         {
-            bool reevaluate = false;
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
+            // If it is earlier than we are currently waiting for, retrigger the scheduler.
+            bool reevaluate = (infoBlock.ScheduleTime() < m_NextTrigger);
 
-            while ((index != m_PendingQueue.end()) && (infoBlock.ScheduleTime() >= (*index).ScheduleTime())) {
-                ++index;
+            Slot(infoBlock.ScheduleTime()).push_back(std::move(infoBlock));
+            m_Pending++;
+
+            return (reevaluate);
+        }
+        // Redistribute the timers in the current slot of the given level (or the overflow
+        // list) over the lower levels.
+        void Cascade(const uint8_t level)
+        {
+            SubscriberList entries;
+
+            if (level == WheelLevels) {
+                entries.swap(m_Overflow);
+            } else {
+                entries.swap(m_Wheel[level][(m_Current >> (WheelBits * level)) & WheelMask]);
+                m_LevelCount[level] -= static_cast<uint32_t>(entries.size());
             }
 
-            if (index == m_PendingQueue.begin()) {
-                m_PendingQueue.push_front(std::move(infoBlock));
+            // Overdue timers are not expired straight away, but go through the first level like all
+            // others, so they expire in order if the thread woke up late.
+            while (entries.empty() == false) {
+                SubscriberList& slot(Wheel(entries.front().ScheduleTime()));
+                slot.splice(slot.end(), entries, entries.begin());
+            }
+        }
+        // Move the wheel forward till now, all timers that are due, end up in the expired list.
+        void Expire(const uint64_t now)
+        {
+            const uint64_t tick = Tick(now);
+
+            m_Now = now;
+
+            while (m_Current <= tick) {
+                if (m_LevelCount[0] != 0) {
+                    SubscriberList& slot(m_Wheel[0][m_Current & WheelMask]);
+                    typename SubscriberList::iterator index(slot.begin());
+
+                    while (index != slot.end()) {
+                        if (index->ScheduleTime() <= now) {
+                            typename SubscriberList::iterator element(index++);
+                            m_Expired.splice(m_Expired.end(), slot, element);
+                            m_LevelCount[0]--;
+                        } else {
+                            ++index;
+                        }
+                    }
+
+                    if (slot.empty() == false) {
+                        // Within this tick, but not yet due.
+                        break;
+                    }
+                }
+
+                // If the lower levels are empty, there is no need to visit every tick, we can
+                // jump to the start of the next block on the first level that has timers.
+                uint8_t empty = 0;
+
+                while ((empty < WheelLevels) && (m_LevelCount[empty] == 0)) {
+                    empty++;
+                }
+
+                const uint64_t step = (static_cast<uint64_t>(1) << (WheelBits * empty));
+                const uint64_t next = ((m_Current | (step - 1)) + 1);
 
-                // If we added the new time up front, retrigger the scheduler.
-                reevaluate = true;
-            } else if (index == m_PendingQueue.end()) {
-                m_PendingQueue.push_back(std::move(infoBlock));
+                m_Current = (next > (tick + 1) ? (tick + 1) : next);
+
+                // Cascade all levels for which we moved into a new slot, top down.
+                for (uint8_t level = WheelLevels; level > 0; level--) {
+                    if ((m_Current & ((static_cast<uint64_t>(1) << (WheelBits * level)) - 1)) == 0) {
+                        Cascade(level);
+                    }
+                }
+            }
+        }
+        // Returns the time at which the thread needs to wake up, either because a timer is due, or
+        // because timers need to be cascaded.
+        uint64_t Earliest() const
+        {
+            uint64_t result = NUMBER_MAX_UNSIGNED(uint64_t);
+
+            if (m_Expired.empty() == false) {
+                result = 0;
             } else {
-                m_PendingQueue.insert(index, std::move(infoBlock));
+                uint8_t level = 0;
+
+                while ((level < WheelLevels) && (m_LevelCount[level] == 0)) {
+                    level++;
+                }
+
+                if (level == 0) {
+                    uint32_t index = static_cast<uint32_t>(m_Current & WheelMask);
+
+                    while ((index < WheelSize) && (m_Wheel[0][index].empty() == true)) {
+                        index++;
+                    }
+
+                    ASSERT(index < WheelSize);
+
+                    if (index < WheelSize) {
+                        typename SubscriberList::const_iterator entry(m_Wheel[0][index].cbegin());
+
+                        while (entry != m_Wheel[0][index].cend()) {
+                            if (entry->ScheduleTime() < result) {
+                                result = entry->ScheduleTime();
+                            }
+                            ++entry;
+                        }
+
+                        // Timers that were late for the tick they belong to, are handled with the next tick.
+                        if (result < (m_Current * Time::TicksPerMillisecond)) {
+                            result = (m_Current * Time::TicksPerMillisecond);
+                        }
+                    }
+                } else if (level < WheelLevels) {
+                    const uint8_t shift = (WheelBits * level);
+                    uint32_t index = static_cast<uint32_t>((m_Current >> shift) & WheelMask) + 1;
+
+                    while ((index < WheelSize) && (m_Wheel[level][index].empty() == true)) {
+                        index++;
+                    }
+
+                    ASSERT(index < WheelSize);
+
+                    if (index < WheelSize) {
+                        result = ((((m_Current >> (shift + WheelBits)) << WheelBits) | index) << shift) * Time::TicksPerMillisecond;
+                    }
+                } else if (m_Overflow.empty() == false) {
+                    const uint8_t shift = (WheelBits * WheelLevels);
+
+                    result = (((m_Current >> shift) + 1) << shift) * Time::TicksPerMillisecond;
+                }
             }
 
-            return (reevaluate);
+            return (result);
         }
-        bool RemoveEntry(typename SubscriberList::iterator& index, const CONTENT& info)
+        // Returns the number of entries removed from the list, if first is set, only the first match is removed.
+        uint32_t RemoveEntry(SubscriberList& list, const CONTENT& info, const bool first)
         {
-            bool changedHead = false;
+            uint32_t removed = 0;
+            typename SubscriberList::iterator index(list.begin());
 
-            while (index != m_PendingQueue.end()) {
+            while ((index != list.end()) && ((first == false) || (removed == 0))) {
                 if (index->Content() == info) {
-                    changedHead = (index == m_PendingQueue.begin());
-
                     // Remove this... Found it, remove it.
-                    index = m_PendingQueue.erase(index);
+                    index = list.erase(index);
+                    removed++;
                 } else {
-
                     ++index;
                 }
             }
 
-            return (changedHead);
+            m_Pending -= removed;
+
+            return (removed);
+        }
+        // The content is only comparable, so this is a walk over all pending timers.
+        bool RemoveEntry(const CONTENT& info, const bool first)
+        {
+            uint32_t removed = RemoveEntry(m_Expired, info, first);
+
+            for (uint8_t level = 0; (level < WheelLevels) && ((first == false) || (removed == 0)); level++) {
+                for (uint32_t index = 0; (m_LevelCount[level] != 0) && (index < WheelSize) && ((first == false) || (removed == 0)); index++) {
+                    uint32_t count = RemoveEntry(m_Wheel[level][index], info, first);
+
+                    m_LevelCount[level] -= count;
+                    removed += count;
+                }
+            }
+
+            if ((first == false) || (removed == 0)) {
+                removed += RemoveEntry(m_Overflow, info, first);
+            }
+
+            return (removed != 0);
         }
 
     private:
-        SubscriberList m_PendingQueue;
+        SubscriberList m_Wheel[WheelLevels][WheelSize];
+        uint32_t m_LevelCount[WheelLevels];
+        SubscriberList m_Overflow;
+        SubscriberList m_Expired;
+        uint64_t m_Now;
+        uint64_t m_Current;
+        uint32_t m_Pending;
         TimeWorker m_TimerThread;
         CriticalSection m_Admin;
         uint64_t m_NextTrigger;
@@ -6,22 +6,170 @@ namespace WPEFramework {
 
 	    /* static */ WorkerPool* WorkerPool::_instance = nullptr;
 
-		WorkerPool::WorkerPool(const uint8_t threadCount, uint32_t* counters)
-			: _handleQueue(16)
+		// The slot the calling thread services in the WorkerPool, ~0 if it is not a pool thread.
+		static thread_local uint8_t _slot = static_cast<uint8_t>(~0);
+
+		WorkerPool::WorkerPool(const uint8_t threadCount, uint32_t* counters, const bool workStealing, const uint8_t minimum, const uint32_t idleTime)
+			: _adminLock()
+			, _handleQueue(16)
+			, _localQueues(workStealing == true ? new LocalQueue[threadCount] : nullptr)
+			, _minimum(((minimum == 0) || (minimum > threadCount)) ? threadCount : minimum)
+			, _idleTime(idleTime)
+			, _active(_minimum)
+			, _joined(false)
+			, _idle(0)
+			, _growing(false)
 			, _occupation(0)
 			, _timer(1024 * 1024, _T("WorkerPool::Timer"))
 		{
 			ASSERT(_instance == nullptr);
+			ASSERT(threadCount > 0);
+			ASSERT(counters != nullptr);
 
 			_metadata.Slots = threadCount;
+			_metadata.Active = _minimum;
 			_metadata.Slot = counters;
+
+			for (uint8_t index = 0; index < threadCount; index++) {
+				_metadata.Slot[index] = 0;
+			}
 			_instance = this;
 		}
 
 		WorkerPool ::~WorkerPool()
 		{
 			_handleQueue.Disable();
+
+			if (_localQueues != nullptr) {
+				for (uint8_t index = 0; index < _metadata.Slots; index++) {
+					_localQueues[index].Clear();
+				}
+				delete[] _localQueues;
+			}
+
 			_instance = nullptr;
 		}
+
+		void WorkerPool::Bind(const uint8_t index)
+		{
+			_slot = index;
+		}
+
+		void WorkerPool::Distribute(const Core::ProxyType<Core::IDispatch>& job)
+		{
+			ASSERT(_localQueues != nullptr);
+
+			if (_slot >= _metadata.Slots) {
+				// Not one of our threads, use the shared queue.
+				_handleQueue.Insert(Job(job), Core::infinite);
+			} else {
+				_localQueues[_slot].Push(Job(job));
+
+				// If there is a slot idling (waiting on the shared queue), wake it up so it
+				// can steal this job. An empty job is used as the wakeup call.
+				if (_idle.load() > 0) {
+					_handleQueue.Post(Job());
+				}
+			}
+		}
+
+		bool WorkerPool::Steal(const uint8_t index, Job& job)
+		{
+			bool result = false;
+
+			for (uint8_t count = 1; ((result == false) && (count < _metadata.Slots)); count++) {
+				result = _localQueues[(index + count) % _metadata.Slots].Pop(job);
+			}
+
+			return (result);
+		}
+
+		void WorkerPool::Grow()
+		{
+			// Only if all running slots are occupied and there is still work waiting, an additional slot is worth it.
+			// Only one submitter grows the pool at a time, the others just carry on with their work.
+			bool expected = false;
+
+			if ((_occupation.load() >= (_active.load() - (_joined == true ? 0 : 1))) && (Pending() > 0) && (_growing.compare_exchange_strong(expected, true) == true)) {
+
+				_adminLock.Lock();
+
+				uint8_t index = _active.load();
+
+				if (index < _metadata.Slots) {
+					_active++;
+				}
+
+				_adminLock.Unlock();
+
+				// Creating (or waking) the minion is done outside the lock, so Retire and Stop are not held up by it.
+				if (index < _metadata.Slots) {
+					Start(index);
+				}
+
+				_growing = false;
+			}
+		}
+
+		bool WorkerPool::Retire(const uint8_t index)
+		{
+			bool result = false;
+
+			_adminLock.Lock();
+
+			// Only the last slot can retire, this keeps the active slots contiguous.
+			if ((_active.load() > _minimum) && (index == (_active.load() - 1))) {
+				_active--;
+				result = true;
+			}
+
+			_adminLock.Unlock();
+
+			return (result);
+		}
+
+		bool WorkerPool::Next(const uint8_t index, Job& job)
+		{
+			// Slots above the minimum, only wait for a limited time for work, if they do not get it, they retire.
+			const uint32_t waitTime = (index < _minimum ? Core::infinite : _idleTime);
+			bool retry;
+			bool result;
+
+			do {
+				result = Fetch(index, job, waitTime);
+
+				retry = ((result == false) && (waitTime != Core::infinite) && (_handleQueue.IsDisabled() == false) && (Retire(index) == false));
+
+			} while (retry == true);
+
+			return (result);
+		}
+
+		bool WorkerPool::Fetch(const uint8_t index, Job& job, const uint32_t waitTime)
+		{
+			bool result;
+
+			if (_localQueues == nullptr) {
+				result = _handleQueue.Extract(job, waitTime);
+			} else {
+				// Every now and then, give the jobs from outside the pool a chance, even
+				// if we have plenty of local work, otherwise they might starve.
+				if (((_metadata.Slot[index] & 0x0F) == 0) && (_handleQueue.Extract(job, 0) == true)) {
+					result = true;
+				} else if ((_localQueues[index].Pop(job) == true) || (Steal(index, job) == true)) {
+					result = true;
+				} else {
+					// Announce that we are idle before the last check, so a Distribute that
+					// raced with the check will post a wakeup call.
+					_idle++;
+
+					result = ((Steal(index, job) == true) || (_handleQueue.Extract(job, waitTime) == true));
+
+					_idle--;
+				}
+			}
+
+			return (result);
+		}
 	}
 }
@@ -3,6 +3,7 @@
 #include "Thread.h"
 #include "Timer.h"
 #include <atomic>
+#include <deque>
 #include <functional>
 
 namespace WPEFramework {
@@ -56,6 +57,10 @@ namespace Core {
                 // No need to reschedule, just drop it..
                 return (0);
             }
+            inline bool IsValid() const
+            {
+                return (_job.IsValid());
+            }
             inline void Dispatch()
             {
                 ASSERT(_job.IsValid() == true);
@@ -157,11 +162,102 @@ namespace Core {
 
         typedef Core::QueueType<Job> MessageQueue;
 
+        // In work stealing mode, every slot (Minion or the thread that Joined the pool) owns a
+        // local queue. Jobs submitted from within a pool thread land in the queue of that thread,
+        // so the shared _handleQueue lock is only taken for submissions from outside the pool.
+        // Idle slots take work from the local queues of the others (stealing).
+        class LocalQueue {
+        private:
+            LocalQueue(const LocalQueue&) = delete;
+            LocalQueue& operator=(const LocalQueue&) = delete;
+
+        public:
+            LocalQueue()
+                : _adminLock()
+                , _jobs()
+                , _count(0)
+            {
+            }
+            ~LocalQueue()
+            {
+            }
+
+        public:
+            inline bool IsEmpty() const
+            {
+                return (_count.load(std::memory_order_relaxed) == 0);
+            }
+            inline uint32_t Length() const
+            {
+                return (_count.load(std::memory_order_relaxed));
+            }
+            void Push(const Job& job)
+            {
+                _adminLock.Lock();
+                _jobs.push_back(job);
+                _count++;
+                _adminLock.Unlock();
+            }
+            bool Pop(Job& job)
+            {
+                bool result = false;
+
+                // Quick check, without the lock, to avoid bothering other slots if there is nothing to take.
+                if (IsEmpty() == false) {
+                    _adminLock.Lock();
+
+                    if (_jobs.empty() == false) {
+                        job = _jobs.front();
+                        _jobs.pop_front();
+                        _count--;
+                        result = true;
+                    }
+
+                    _adminLock.Unlock();
+                }
+
+                return (result);
+            }
+            bool Remove(const Job& job)
+            {
+                bool result = false;
+
+                if (IsEmpty() == false) {
+                    _adminLock.Lock();
+
+                    std::deque<Job>::iterator index(std::find(_jobs.begin(), _jobs.end(), job));
+
+                    if (index != _jobs.end()) {
+                        _jobs.erase(index);
+                        _count--;
+                        result = true;
+                    }
+
+                    _adminLock.Unlock();
+                }
+
+                return (result);
+            }
+            void Clear()
+            {
+                _adminLock.Lock();
+                _jobs.clear();
+                _count = 0;
+                _adminLock.Unlock();
+            }
+
+        private:
+            Core::CriticalSection _adminLock;
+            std::deque<Job> _jobs;
+            std::atomic<uint32_t> _count;
+        };
+
     public:
         struct Metadata {
             uint32_t Pending;
             uint32_t Occupation;
             uint8_t Slots;
+            uint8_t Active;
             uint32_t* Slot;
         };
 
@@ -178,7 +274,15 @@ namespace Core {
     public:
         inline void Submit(const Core::ProxyType<Core::IDispatch>& job)
         {
-            _handleQueue.Insert(Job(job), Core::infinite);
+            if (_localQueues == nullptr) {
+                _handleQueue.Insert(Job(job), Core::infinite);
+            } else {
+                Distribute(job);
+            }
+
+            if (_active < _metadata.Slots) {
+                Grow();
+            }
         }
         inline void Schedule(const Core::Time& time, const Core::ProxyType<Core::IDispatch>& job)
         {
@@ -187,30 +291,47 @@ namespace Core {
         inline uint32_t Revoke(const Core::ProxyType<Core::IDispatch>& job, const uint32_t waitTime = Core::infinite)
         {
             Job compare(job);
-            return (_timer.Revoke(compare) == true || _handleQueue.Remove(compare) ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+            return (_timer.Revoke(compare) == true || _handleQueue.Remove(compare) || RemoveLocal(compare) ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
         inline const WorkerPool::Metadata& Snapshot()
         {
             _metadata.Occupation = _occupation.load();
-            _metadata.Pending = _handleQueue.Length();
+            _metadata.Pending = Pending();
+            _metadata.Active = _active.load();
             return (_metadata);
         }
+        inline bool IsWorkStealing() const
+        {
+            return (_localQueues != nullptr);
+        }
+        inline bool IsElastic() const
+        {
+            return (_minimum < _metadata.Slots);
+        }
 	void Join() {
+            _joined = true;
             Process(0);
 	}
         void Run()
         {
             _handleQueue.Enable();
-            for (uint8_t index = 1; index < _metadata.Slots; index++) {
-                Minion& minion = Index(index);
-                minion.Set(*this, index);
-                minion.Run();
+
+            _adminLock.Lock();
+            for (uint8_t index = 1; index < _active; index++) {
+                Start(index);
             }
+            _adminLock.Unlock();
         }
         void Stop()
         {
             _handleQueue.Disable();
-            for (uint8_t index = 1; index < _metadata.Slots; index++) {
+
+            // No new slots will be started, the queue is disabled, so from here on, _active can only shrink.
+            _adminLock.Lock();
+            uint8_t count = _active;
+            _adminLock.Unlock();
+
+            for (uint8_t index = 1; index < count; index++) {
                 Minion& minion = Index(index);
                 minion.Block();
                 minion.Wait(Core::Thread::BLOCKED | Core::Thread::STOPPED, Core::infinite);
@@ -226,7 +347,7 @@ namespace Core {
             else if (index == 1) {
                 result = 0;
             }
-            else if (index < _metadata.Slots) {
+            else if (index < _active) {
                 result = const_cast<WorkerPool&>(*this).Index(index - 1).ThreadId();
             }
 
@@ -234,7 +355,10 @@ namespace Core {
         }
 
     protected:
-        WorkerPool(const uint8_t threadCount, uint32_t* counters);
+        // If a minimum, lower than the threadCount, is given the pool is elastic. It starts with the
+        // minimum number of slots and grows, up to threadCount, if all slots are occupied while there
+        // is work pending. Slots above the minimum retire after being idle for idleTime (mS).
+        WorkerPool(const uint8_t threadCount, uint32_t* counters, const bool workStealing = false, const uint8_t minimum = 0, const uint32_t idleTime = 30000);
 
         virtual Minion& Index(const uint8_t index) = 0;
         virtual bool Running() = 0;
@@ -243,20 +367,77 @@ namespace Core {
         {
             Job newRequest;
 
-            while ((Running() == true) && (_handleQueue.Extract(newRequest, Core::infinite) == true)) {
+            Bind(index);
+
+            while ((Running() == true) && (Next(index, newRequest) == true)) {
 
-                _metadata.Slot[index]++;
+                // An empty job is a wakeup call, there is work to steal..
+                if (newRequest.IsValid() == true) {
 
-                _occupation++;
+                    _metadata.Slot[index]++;
 
-                newRequest.Dispatch();
+                    _occupation++;
 
-                _occupation--;
+                    newRequest.Dispatch();
+
+                    _occupation--;
+                }
             }
+
+            Bind(static_cast<uint8_t>(~0));
+        }
+
+    private:
+        inline uint32_t Pending() const
+        {
+            uint32_t result = _handleQueue.Length();
+
+            if (_localQueues != nullptr) {
+                for (uint8_t index = 0; index < _metadata.Slots; index++) {
+                    result += _localQueues[index].Length();
+                }
+            }
+            return (result);
+        }
+        inline void Start(const uint8_t index)
+        {
+            Minion& minion = Index(index);
+
+            // A retired minion might still be on its way out of Process, wait till it is really blocked.
+            minion.Wait(Core::Thread::BLOCKED | Core::Thread::STOPPED, Core::infinite);
+            minion.Set(*this, index);
+            minion.Run();
+        }
+        void Bind(const uint8_t index);
+        void Distribute(const Core::ProxyType<Core::IDispatch>& job);
+        void Grow();
+        bool Retire(const uint8_t index);
+        bool Next(const uint8_t index, Job& job);
+        bool Fetch(const uint8_t index, Job& job, const uint32_t waitTime);
+        bool Steal(const uint8_t index, Job& job);
+        bool RemoveLocal(const Job& job)
+        {
+            bool result = false;
+
+            if (_localQueues != nullptr) {
+                for (uint8_t index = 0; ((result == false) && (index < _metadata.Slots)); index++) {
+                    result = _localQueues[index].Remove(job);
+                }
+            }
+
+            return (result);
         }
 
     private:
+        Core::CriticalSection _adminLock;
         MessageQueue _handleQueue;
+        LocalQueue* _localQueues;
+        const uint8_t _minimum;
+        const uint32_t _idleTime;
+        std::atomic<uint8_t> _active;
+        std::atomic<bool> _joined;
+        std::atomic<uint8_t> _idle;
+        std::atomic<bool> _growing;
         std::atomic<uint8_t> _occupation;
         Core::TimerType<Job> _timer;
         Metadata _metadata;
@@ -271,8 +452,8 @@ namespace Core {
         WorkerPoolType<THREAD_COUNT>& operator=(const WorkerPoolType<THREAD_COUNT>&) = delete;
 
     public:
-        WorkerPoolType(const uint32_t stackSize)
-            : WorkerPool(THREAD_COUNT, &(_counters[0]))
+        WorkerPoolType(const uint32_t stackSize, const bool workStealing = false)
+            : WorkerPool(THREAD_COUNT, &(_counters[0]), workStealing)
             , _minions()
         {
         }
@@ -51,6 +51,21 @@ public:
     ~DataExchange() {}
 
 public:
+    // A server that wants to pipeline decrypts for a session creates, next to
+    // the buffer it announces, additional buffers named <name>.1 .. <name>.N-1.
+    // Each of them is a full DataExchange with its own semaphores, so the
+    // client can have a sample in every slot while the server works on them.
+    static string SlotName(const string& name, const uint8_t slot)
+    {
+        return (slot == 0 ? name : name + '.' + WPEFramework::Core::NumberType<uint8_t>(slot).Text());
+    }
+    static bool HasSlot(const string& name, const uint8_t slot)
+    {
+        const string slotName(SlotName(name, slot));
+
+        return ((WPEFramework::Core::File(slotName).Exists() == true) && (WPEFramework::Core::File(slotName + _T(".admin")).Exists() == true));
+    }
+
     inline void Status(uint32_t status)
     {
         reinterpret_cast<Administration*>(AdministrationBuffer())->Status = status;
@@ -463,6 +463,38 @@ OpenCDMError opencdm_session_decrypt(struct OpenCDMSession* session,
     return (result);
 }
 
+/**
+ * \brief Submits a sample for decryption and returns without waiting for it.
+ *
+ * The callback is invoked, in submission order, once the sample is decrypted.
+ * The encrypted buffer must stay valid until then.
+ * \param session \ref OpenCDMSession instance.
+ * \param encrypted Buffer containing encrypted data, decrypted in-place.
+ * \param encryptedLength Length of encrypted data buffer (in bytes).
+ * \param IV Initial vector (IV) used during decryption.
+ * \param IVLength Length of IV buffer (in bytes).
+ * \param callback Function called once the sample is decrypted.
+ * \param userData Passed to the callback as is.
+ * \return Zero if the sample is queued, non-zero on error.
+ */
+OpenCDMError opencdm_session_decrypt_async(struct OpenCDMSession* session,
+    uint8_t encrypted[],
+    const uint32_t encryptedLength,
+    const uint8_t* IV, const uint16_t IVLength,
+    const uint8_t* keyId, const uint16_t keyIdLength,
+    uint32_t initWithLast15,
+    OpenCDMDecryptCallback callback, void* userData)
+{
+    OpenCDMError result(ERROR_INVALID_SESSION);
+
+    if (session != nullptr) {
+        result = static_cast<OpenCDMError>(session->Decrypt(
+            encrypted, encryptedLength, IV, IVLength, keyId, keyIdLength, initWithLast15, callback, userData));
+    }
+
+    return (result);
+}
+
 
 bool OpenCDMAccessor::WaitForKey(const uint8_t keyLength, const uint8_t keyId[],
         const uint32_t waitTime,
@@ -484,6 +484,46 @@ EXTERNAL OpenCDMError opencdm_session_decrypt(struct OpenCDMSession* session,
     uint32_t initWithLast15);
 #endif // __cplusplus
 
+/**
+ * Signature of the function called when an asynchronous decrypt completes.
+ * \param session \ref OpenCDMSession the sample was submitted to.
+ * \param userData Pointer passed along with the sample.
+ * \param result Zero on success, non-zero on error.
+ * \param encrypted Buffer that was submitted, now holding the decrypted data.
+ * \param encryptedLength Length of the buffer (in bytes).
+ */
+typedef void (*OpenCDMDecryptCallback)(struct OpenCDMSession* session, void* userData,
+    OpenCDMError result, uint8_t encrypted[], uint32_t encryptedLength);
+
+/**
+ * \brief Submits a sample for decryption and returns without waiting for it.
+ *
+ * Samples are handed to the DRM process in submission order and, if the
+ * session offers more than one shared buffer, several samples are decrypted
+ * while the caller prepares the next ones. The callback is invoked from a
+ * session owned thread, in submission order. The encrypted buffer must stay
+ * valid until the callback for it has been invoked, IV and keyID are copied.
+ * \param session \ref OpenCDMSession instance.
+ * \param encrypted Buffer containing encrypted data, decrypted in-place.
+ * \param encryptedLength Length of encrypted data buffer (in bytes).
+ * \param IV Initial vector (IV) used during decryption.
+ * \param IVLength Length of IV buffer (in bytes).
+ * \param keyID keyID to use for decryption
+ * \param keyIDLength Length of keyID buffer (in bytes).
+ * \param initWithLast15 Whether decryption context needs to be initialized with
+ * last 15 bytes. Currently this only applies to PlayReady DRM.
+ * \param callback Function called once the sample is decrypted.
+ * \param userData Passed to the callback as is.
+ * \return Zero if the sample is queued, non-zero on error (no callback follows).
+ */
+EXTERNAL OpenCDMError opencdm_session_decrypt_async(struct OpenCDMSession* session,
+    uint8_t encrypted[],
+    const uint32_t encryptedLength,
+    const uint8_t* IV, uint16_t IVLength,
+    const uint8_t* keyId, const uint16_t keyIdLength,
+    uint32_t initWithLast15,
+    OpenCDMDecryptCallback callback, void* userData);
+
 #ifdef __cplusplus
 }
 #endif
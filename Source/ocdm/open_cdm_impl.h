@@ -366,20 +366,103 @@ private:
         DataExchange(const DataExchange&) = delete;
         DataExchange& operator=(DataExchange&) = delete;
 
+        static constexpr uint8_t MaxSlots = 8;
+        static constexpr uint8_t NoSlot = 0xFF;
+
+        struct Request {
+            OpenCDMDecryptCallback Callback;
+            void* UserData;
+            uint8_t* Data;
+            uint32_t Length;
+            uint8_t IV[24];
+            uint8_t IVLength;
+            uint8_t KeyId[16];
+            uint8_t KeyIdLength;
+            uint32_t InitWithLast15;
+            uint8_t Slot;
+            uint32_t Result;
+        };
+        typedef std::list<Request> Requests;
+
+        class Pipeline : public Core::Thread {
+        private:
+            Pipeline() = delete;
+            Pipeline(const Pipeline&) = delete;
+            Pipeline& operator=(const Pipeline&) = delete;
+
+        public:
+            Pipeline(DataExchange& parent)
+                : Core::Thread(Core::Thread::DefaultStackSize(), _T("OCDMDecrypt"))
+                , _parent(parent)
+            {
+            }
+            virtual ~Pipeline()
+            {
+                Stop();
+                Wait(Thread::BLOCKED | Thread::STOPPED, Core::infinite);
+            }
+
+        public:
+            virtual uint32_t Worker()
+            {
+                return (_parent.Worker(*this));
+            }
+
+        private:
+            DataExchange& _parent;
+        };
+
+        struct Waiter {
+            Waiter()
+                : Signal(false, true)
+                , Result(0)
+            {
+            }
+
+            Core::Event Signal;
+            uint32_t Result;
+        };
+
     public:
-        DataExchange(const string& bufferName)
+        DataExchange(OpenCDMSession& session, const string& bufferName)
             : OCDM::DataExchange(bufferName)
+            , _session(session)
+            , _adminLock()
+            , _queueLock()
+            , _slots()
+            , _next(0)
+            , _pipeline(nullptr)
+            , _queue()
+            , _inflight()
+            , _free()
             , _busy(false)
         {
+            _slots.push_back(this);
 
-            TRACE_L1("Constructing buffer client side: %p - %s", this,
-                bufferName.c_str());
+            // If the server offers more buffers for this session, we can have
+            // more samples under way at the same time.
+            while ((_slots.size() < MaxSlots) && (OCDM::DataExchange::HasSlot(bufferName, static_cast<uint8_t>(_slots.size())) == true)) {
+                _slots.push_back(new OCDM::DataExchange(OCDM::DataExchange::SlotName(bufferName, static_cast<uint8_t>(_slots.size()))));
+            }
+
+            TRACE_L1("Constructing buffer client side: %p - %s [%d slots]", this,
+                bufferName.c_str(), static_cast<uint32_t>(_slots.size()));
         }
         virtual ~DataExchange()
         {
+            if (_pipeline != nullptr) {
+                delete _pipeline;
+
+                // Whatever is still under way, will not be reported by the server anymore.
+                Fail(_inflight);
+                Fail(_queue);
+            }
             if (_busy == true) {
                 TRACE_L1("Destructed a DataExchange while still in progress. %p", this);
             }
+            for (uint8_t index = 1; index < _slots.size(); index++) {
+                delete _slots[index];
+            }
             TRACE_L1("Destructing buffer client side: %p - %s", this,
                 OCDM::DataExchange::Name().c_str());
         }
@@ -390,54 +473,228 @@ private:
             const uint8_t* keyId, uint16_t keyIdLength,
             uint32_t initWithLast15 /* = 0 */)
         {
-            int ret = 0;
+            uint32_t ret = 0;
+
+            // The shared buffers belong to this session only, so the lock only
+            // needs to keep the callers of this session apart. Audio and video
+            // sessions run their decrypts side by side.
+            _adminLock.Lock();
 
-            // This works, because we know that the Audio and the Video streams are
-            // fed from
-            // the same process, so they will use the same critial section and thus
-            // will
-            // not interfere with each-other. If Audio and video will be located into
-            // two
-            // different processes, start using the administartion space to share a
-            // lock.
-            _systemLock.Lock();
+            if (_pipeline == nullptr) {
+                Request request;
 
-            _busy = true;
+                _busy = true;
 
-            if (RequestProduce(WPEFramework::Core::infinite) == WPEFramework::Core::ERROR_NONE) {
+                Prepare(request, encryptedData, encryptedDataLength, ivData, ivDataLength, keyId, keyIdLength, initWithLast15);
 
-                SetIV(static_cast<uint8_t>(ivDataLength), ivData);
-                SetSubSampleData(0, nullptr);
-                KeyId(static_cast<uint8_t>(keyIdLength), keyId);
-                InitWithLast15(initWithLast15);
-                Write(encryptedDataLength, encryptedData);
+                if (Submit(*this, request) == true) {
+                    ret = Collect(*this, request);
+                }
+
+                _busy = false;
+
+                _adminLock.Unlock();
+            } else {
+                // Asynchronous samples are under way, line up behind them.
+                Waiter waiter;
+
+                _adminLock.Unlock();
+
+                Queue(encryptedData, encryptedDataLength, ivData, ivDataLength, keyId, keyIdLength, initWithLast15, Signal, &waiter);
+
+                waiter.Signal.Lock(Core::infinite);
+                ret = waiter.Result;
+            }
+
+            return (ret);
+        }
+        uint32_t Decrypt(uint8_t* encryptedData, uint32_t encryptedDataLength,
+            const uint8_t* ivData, uint16_t ivDataLength,
+            const uint8_t* keyId, uint16_t keyIdLength,
+            uint32_t initWithLast15,
+            OpenCDMDecryptCallback callback, void* userData)
+        {
+            _adminLock.Lock();
+
+            if (_pipeline == nullptr) {
+                _pipeline = new Pipeline(*this);
+            }
+
+            _adminLock.Unlock();
+
+            Queue(encryptedData, encryptedDataLength, ivData, ivDataLength, keyId, keyIdLength, initWithLast15, callback, userData);
+
+            return (OpenCDMError::ERROR_NONE);
+        }
+
+    private:
+        static void Signal(struct OpenCDMSession*, void* userData, OpenCDMError result, uint8_t[], uint32_t)
+        {
+            Waiter* waiter = reinterpret_cast<Waiter*>(userData);
+
+            waiter->Result = result;
+            waiter->Signal.SetEvent();
+        }
+        static void Prepare(Request& request, uint8_t* encryptedData, uint32_t encryptedDataLength,
+            const uint8_t* ivData, uint16_t ivDataLength,
+            const uint8_t* keyId, uint16_t keyIdLength,
+            uint32_t initWithLast15)
+        {
+            ASSERT(ivDataLength <= sizeof(request.IV));
+            ASSERT(keyIdLength <= sizeof(request.KeyId));
+
+            request.Data = encryptedData;
+            request.Length = encryptedDataLength;
+            request.IVLength = static_cast<uint8_t>(std::min(static_cast<size_t>(ivDataLength), sizeof(request.IV)));
+            request.KeyIdLength = static_cast<uint8_t>(std::min(static_cast<size_t>(keyIdLength), sizeof(request.KeyId)));
+            request.InitWithLast15 = initWithLast15;
+            request.Slot = NoSlot;
+            request.Result = 0;
+
+            if ((ivData != nullptr) && (request.IVLength > 0)) {
+                ::memcpy(request.IV, ivData, request.IVLength);
+            } else {
+                request.IVLength = 0;
+            }
+            if ((keyId != nullptr) && (request.KeyIdLength > 0)) {
+                ::memcpy(request.KeyId, keyId, request.KeyIdLength);
+            } else {
+                request.KeyIdLength = 0;
+            }
+        }
+        static bool Submit(OCDM::DataExchange& slot, const Request& request)
+        {
+            bool result = (slot.RequestProduce(WPEFramework::Core::infinite) == WPEFramework::Core::ERROR_NONE);
+
+            if (result == true) {
+                slot.SetIV(request.IVLength, request.IV);
+                slot.SetSubSampleData(0, nullptr);
+                slot.KeyId(request.KeyIdLength, request.KeyId);
+                slot.InitWithLast15(request.InitWithLast15);
+                slot.Write(request.Length, request.Data);
 
                 // This will trigger the OpenCDMIServer to decrypt this memory...
-                Produced();
+                slot.Produced();
+            }
+
+            return (result);
+        }
+        static uint32_t Collect(OCDM::DataExchange& slot, const Request& request)
+        {
+            uint32_t result = OpenCDMError::ERROR_INVALID_DECRYPT_BUFFER;
+
+            // Now we should wait till it is decrypted, that happens if the
+            // Producer, can run again.
+            if (slot.RequestProduce(WPEFramework::Core::infinite) == WPEFramework::Core::ERROR_NONE) {
+
+                // For nowe we just copy the clear data..
+                slot.Read(request.Length, request.Data);
+
+                // Get the status of the last decrypt.
+                result = slot.Status();
+
+                // And free the lock, for the next production Scenario..
+                slot.Consumed();
+            }
+
+            return (result);
+        }
+        void Queue(uint8_t* encryptedData, uint32_t encryptedDataLength,
+            const uint8_t* ivData, uint16_t ivDataLength,
+            const uint8_t* keyId, uint16_t keyIdLength,
+            uint32_t initWithLast15,
+            OpenCDMDecryptCallback callback, void* userData)
+        {
+            _queueLock.Lock();
+
+            if (_free.empty() == true) {
+                _queue.emplace_back();
+            } else {
+                _queue.splice(_queue.end(), _free, _free.begin());
+            }
+
+            Request& request(_queue.back());
+
+            Prepare(request, encryptedData, encryptedDataLength, ivData, ivDataLength, keyId, keyIdLength, initWithLast15);
+            request.Callback = callback;
+            request.UserData = userData;
+
+            _queueLock.Unlock();
+
+            _pipeline->Run();
+        }
+        void Fail(Requests& requests)
+        {
+            for (Request& request : requests) {
+                request.Callback(&_session, request.UserData, OpenCDMError::ERROR_INVALID_SESSION, request.Data, request.Length);
+            }
+            requests.clear();
+        }
+        uint32_t Worker(Pipeline& pipeline)
+        {
+            uint32_t delay = 0;
+
+            // Fill all free slots before waiting on the oldest one, the server
+            // decrypts the next samples while we copy this one back.
+            _queueLock.Lock();
 
-                // Now we should wait till it is decrypted, that happens if the
-                // Producer, can run again.
-                if (RequestProduce(WPEFramework::Core::infinite) == WPEFramework::Core::ERROR_NONE) {
+            while ((_queue.empty() == false) && (_inflight.size() < _slots.size())) {
+                _inflight.splice(_inflight.end(), _queue, _queue.begin());
 
-                    // For nowe we just copy the clear data..
-                    Read(encryptedDataLength, encryptedData);
+                _queueLock.Unlock();
 
-                    // Get the status of the last decrypt.
-                    ret = Status();
+                Request& request(_inflight.back());
 
-                    // And free the lock, for the next production Scenario..
-                    Consumed();
+                if (request.Length > 0) {
+                    if (Submit(*_slots[_next], request) == true) {
+                        request.Slot = _next;
+                        _next = static_cast<uint8_t>((_next + 1) % _slots.size());
+                    } else {
+                        request.Result = OpenCDMError::ERROR_INVALID_DECRYPT_BUFFER;
+                    }
                 }
+
+                _queueLock.Lock();
             }
 
-            _busy = false;
+            if (_inflight.empty() == false) {
+                _queueLock.Unlock();
 
-            _systemLock.Unlock();
+                Request& request(_inflight.front());
 
-            return (ret);
+                if (request.Slot != NoSlot) {
+                    request.Result = Collect(*_slots[request.Slot], request);
+
+                    if (request.Result != 0) {
+                        TRACE_L1("Decrypt() failed with return code: %x", request.Result);
+                        request.Result = OpenCDMError::ERROR_UNKNOWN;
+                    }
+                }
+
+                request.Callback(&_session, request.UserData, static_cast<OpenCDMError>(request.Result), request.Data, request.Length);
+
+                _queueLock.Lock();
+                _free.splice(_free.end(), _inflight, _inflight.begin());
+            } else if (_queue.empty() == true) {
+                pipeline.Block();
+                delay = Core::infinite;
+            }
+
+            _queueLock.Unlock();
+
+            return (delay);
         }
 
     private:
+        OpenCDMSession& _session;
+        Core::CriticalSection _adminLock;
+        Core::CriticalSection _queueLock;
+        std::vector<OCDM::DataExchange*> _slots;
+        uint8_t _next;
+        Pipeline* _pipeline;
+        Requests _queue;
+        Requests _inflight;
+        Requests _free;
         bool _busy;
     };
 
@@ -599,6 +856,20 @@ public:
         }
         return (result);
     }
+    uint32_t Decrypt(uint8_t* encryptedData, const uint32_t encryptedDataLength,
+        const uint8_t* ivData, uint16_t ivDataLength,
+        const uint8_t* keyId, const uint16_t keyIdLength,
+        uint32_t initWithLast15,
+        OpenCDMDecryptCallback callback, void* userData)
+    {
+        uint32_t result = OpenCDMError::ERROR_INVALID_DECRYPT_BUFFER;
+        if ((_decryptSession != nullptr) && (callback != nullptr)) {
+            result = _decryptSession->Decrypt(encryptedData, encryptedDataLength, ivData,
+                ivDataLength, keyId, keyIdLength,
+                initWithLast15, callback, userData);
+        }
+        return (result);
+    }
 
     uint32_t SessionIdExt() const
     {
@@ -688,7 +959,7 @@ protected:
             ASSERT (_decryptSession == nullptr);
 
             _session->AddRef();
-            _decryptSession = new DataExchange(_session->BufferId());
+            _decryptSession = new DataExchange(*this, _session->BufferId());
             _sessionExt = _session->QueryInterface<OCDM::ISessionExt>();
         }
     }
@@ -73,6 +73,7 @@ namespace PluginHost {
             SerializerImpl(Channel& parent)
                 : _parent(parent)
                 , _current()
+                , _package(nullptr)
                 , _offset(0)
             {
             }
@@ -85,17 +86,25 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-			inline uint16_t Serialize(char* stream, const uint16_t length) const {
+			inline uint16_t Serialize(uint8_t* stream, const uint16_t length) const {
                 uint16_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     _current = Core::ProxyType<const Core::JSON::IElement>(_parent.Element());
+                    _package = ((_current.IsValid() == true) && (_parent.IsMessagePack() == true) ? dynamic_cast<const Core::JSON::IMessagePack*>(_current.operator->()) : nullptr);
+
+                    ASSERT((_package != nullptr) || (_current.IsValid() == false) || (_parent.IsMessagePack() == false));
 				}
 
 				if (_current.IsValid() == true) {
-                    loaded = _current->Serialize(stream, length, _offset);
+                    if (_package != nullptr) {
+                        loaded = _package->Serialize(stream, length, _offset);
+                    } else {
+                        loaded = _current->Serialize(reinterpret_cast<char*>(stream), length, _offset);
+                    }
                     if ( (_offset == 0) || (loaded != length) ) {
                         _current.Release();
+                        _package = nullptr;
                     }
                 }
 
@@ -105,6 +114,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             mutable Core::ProxyType<const Core::JSON::IElement> _current;
+            mutable const Core::JSON::IMessagePack* _package;
             mutable uint16_t _offset;
         };
         class EXTERNAL DeserializerImpl {
@@ -116,6 +126,7 @@ namespace PluginHost {
             DeserializerImpl(Channel& parent)
                 : _parent(parent)
                 , _current()
+                , _package(nullptr)
                 , _offset(0)
             {
             }
@@ -128,21 +139,29 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Deserialize(const char* stream, const uint16_t length)
+            inline uint16_t Deserialize(const uint8_t* stream, const uint16_t length)
             {
 			    uint16_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     if (_parent.IsOpen() == true) {
                         _current = _parent.Element(EMPTY_STRING);
+                        _package = ((_current.IsValid() == true) && (_parent.IsMessagePack() == true) ? dynamic_cast<Core::JSON::IMessagePack*>(_current.operator->()) : nullptr);
                         _offset = 0;
+
+                        ASSERT((_package != nullptr) || (_current.IsValid() == false) || (_parent.IsMessagePack() == false));
                     }
                 } 
 				if (_current.IsValid() == true) {
-                    loaded = _current->Deserialize(stream, length, _offset);
+                    if (_package != nullptr) {
+                        loaded = _package->Deserialize(stream, length, _offset);
+                    } else {
+                        loaded = _current->Deserialize(reinterpret_cast<const char*>(stream), length, _offset);
+                    }
                     if ( (_offset == 0) || (loaded != length)) {
                         _parent.Received(_current);
                         _current.Release();
+                        _package = nullptr;
                     }
                 }
 
@@ -152,6 +171,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
+            Core::JSON::IMessagePack* _package;
             uint16_t _offset;
         };
 
@@ -211,6 +231,12 @@ namespace PluginHost {
         {
             return ((_state & 0x8000) != 0);
         }
+        // JSON and JSONRPC channels can be negotiated to carry their objects as MessagePack, in
+        // binary frames, instead of JSON text.
+        inline bool IsMessagePack() const
+        {
+            return ((_state & 0x2000) != 0);
+        }
         inline void Submit(const string& text)
         {
             if (IsOpen() == true) {
@@ -271,10 +297,12 @@ namespace PluginHost {
         {
             _nameOffset = offset;
         }
-        inline void State(const ChannelState state, const bool notification)
+        inline void State(const ChannelState state, const bool notification, const bool messagePack = false)
         {
-            Binary(state == RAW);
-            _state = state | (notification ? 0x8000 : 0x0000);
+            ASSERT((messagePack == false) || (state == JSON) || (state == JSONRPC));
+
+            Binary((state == RAW) || (messagePack == true));
+            _state = state | (notification ? 0x8000 : 0x0000) | (messagePack ? 0x2000 : 0x0000);
         }
         inline uint16_t Serialize(uint8_t* dataFrame, const uint16_t maxSendSize)
         {
@@ -286,7 +314,7 @@ namespace PluginHost {
                 case JSON:
                 case JSONRPC: {
                     // Seems we are sending JSON structs
-                    size = _serializer.Serialize(reinterpret_cast<char*>(dataFrame), maxSendSize);
+                    size = _serializer.Serialize(dataFrame, maxSendSize);
 
                     if (_serializer.IsIdle() == true) {
 
@@ -353,7 +381,7 @@ namespace PluginHost {
             switch (State()) {
             case JSON:
             case JSONRPC: {
-                handled = _deserializer.Deserialize(reinterpret_cast<const char*>(dataFrame), receivedSize);
+                handled = _deserializer.Deserialize(dataFrame, receivedSize);
                 break;
             }
             case TEXT: {
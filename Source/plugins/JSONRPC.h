@@ -14,6 +14,13 @@ namespace PluginHost {
 
         virtual Core::ProxyType<Core::JSONRPC::Message> Invoke(const uint32_t channelId, const Core::JSONRPC::Message& message) = 0;
 
+        // The typed object the parameters for the given designator can be deserialized in directly, if any.
+        // A dispatcher that has none gets its parameters as text.
+        virtual Core::ProxyType<Core::JSON::IElement> Parameters(const string& /* designator */)
+        {
+            return (Core::ProxyType<Core::JSON::IElement>());
+        }
+
         // Methods used directly by the Framework to handle MetaData requirements.
         // There should be no need to call these methods from the implementation directly.
         virtual void Activate(IShell* service) = 0;
@@ -288,23 +295,42 @@ namespace PluginHost {
                 }
                 break;
             case STATE_CUSTOM:
-                string result;
-                uint32_t code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters.Value(), result);
-                if (response.IsValid() == true) {
+                if (inbound.Parameters.IsMismatched() == true) {
+                    // The parameters did not fit the typed object of this method.
+                    response->Error.SetError(Core::ERROR_INVALID_SIGNATURE);
+                    response->Error.Text = _T("Invalid parameters.");
+                } else {
+                    uint32_t code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters, response->Result);
                     if (code == static_cast<uint32_t>(~0)) {
                         response.Release();
                     } else if (code == Core::ERROR_NONE) {
-                        response->Result = result;
+                        if (response->Result.IsSet() == false) {
+                            response->Result.Null(true);
+                        }
                     } else {
+                        response->Result.Clear();
                         response->Error.Code = code;
                         response->Error.Text = Core::ErrorToString(code);
                     }
                 }
+                break;
             }
 
             return response;
         }
 
+        virtual Core::ProxyType<Core::JSON::IElement> Parameters(const string& designator) override
+        {
+            Core::ProxyType<Core::JSON::IElement> result;
+            Core::JSONRPC::Handler* source = nullptr;
+
+            if (Destination(designator, source) == STATE_CUSTOM) {
+                result = source->Parameters(designator);
+            }
+
+            return (result);
+        }
+
     private:
         state Destination(const string& designator, Core::JSONRPC::Handler*& source)
         {
@@ -326,18 +352,20 @@ namespace PluginHost {
                 if (index == _handlers.end()) {
                     result = STATE_INCORRECT_VERSION;
                 } else {
-                    string method(Core::JSONRPC::Message::Method(designator));
+                    size_t offset, length;
+
+                    Core::JSONRPC::Message::Method(designator, offset, length);
 
-                    if (method == _T("register")) {
+                    if (designator.compare(offset, length, _T("register")) == 0) {
                         result = STATE_REGISTRATION;
                         source = &(*index);
-                    } else if (method == _T("unregister")) {
+                    } else if (designator.compare(offset, length, _T("unregister")) == 0) {
                         result = STATE_UNREGISTRATION;
                         source = &(*index);
-                    } else if (method == _T("exists")) {
+                    } else if (designator.compare(offset, length, _T("exists")) == 0) {
                         result = STATE_EXISTS;
                         source = &(*index);
-                    } else if (index->Exists(method) == Core::ERROR_NONE) {
+                    } else if (index->Exists(designator, offset, length) == Core::ERROR_NONE) {
                         source = &(*index);
                         result = STATE_CUSTOM;
                     } else {
@@ -90,6 +90,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
+        Add(_T("activation"), &Activation);
     }
     MetaData::Service::Service(const MetaData::Service& copy)
         : Plugin::Config(copy)
@@ -103,6 +104,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         , Module(copy.Module)
         , Hash(copy.Hash)
+        , Activation(copy.Activation)
     {
         Add(_T("state"), &JSONState);
 #ifdef RUNTIME_STATISTICS
@@ -114,6 +116,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
+        Add(_T("activation"), &Activation);
     }
     MetaData::Service::~Service()
     {
@@ -207,6 +210,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
         Core::JSON::Container::Add(_T("pending"), &PendingRequests);
         Core::JSON::Container::Add(_T("occupation"), &PoolOccupation);
+        Core::JSON::Container::Add(_T("active"), &ActiveThreads);
     }
     MetaData::Server::~Server()
     {
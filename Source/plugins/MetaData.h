@@ -69,6 +69,7 @@ namespace PluginHost {
 #endif
             Core::JSON::String Module;
             Core::JSON::String Hash;
+            Core::JSON::DecUInt32 Activation;
         };
 
         class EXTERNAL Channel : public Core::JSON::Container {
@@ -150,6 +151,7 @@ namespace PluginHost {
             Core::JSON::ArrayType<Core::JSON::DecUInt32> ThreadPoolRuns;
             Core::JSON::DecUInt32 PendingRequests;
             Core::JSON::DecUInt32 PoolOccupation;
+            Core::JSON::DecUInt8 ActiveThreads;
         };
 
         class EXTERNAL SubSystem : public Core::JSON::Container {
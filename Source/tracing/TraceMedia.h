@@ -27,6 +27,7 @@ namespace Trace {
                 , // 32 bytes for preamble
                 _parent(parent)
             {
+                Batch(8);
             }
             virtual ~Channel()
             {
@@ -94,6 +94,7 @@ namespace Trace {
         , m_Admin()
         , m_OutputChannel(nullptr)
         , m_DirectOut(false)
+        , m_Staging(nullptr)
     {
     }
 
@@ -124,7 +125,8 @@ namespace Trace {
 
             TRACE_L1("Flushing TRACE data !!! %d", __LINE__);
 
-            cursor.Forward(chunkSize);
+            // A frame without a size can not be skipped, so drop whatever is needed.
+            cursor.Forward(chunkSize != 0 ? chunkSize : cursor.Size() - cursor.Offset());
         }
 
         return cursor.Offset();
@@ -135,6 +137,143 @@ namespace Trace {
         _doorBell.Ring();
     }
 
+    TraceUnit::TraceStaging::TraceStaging(TraceUnit& parent)
+        : Core::Thread(Core::Thread::DefaultStackSize(), _T("TraceStaging"))
+        , _parent(parent)
+        , _head(0)
+        , _tail(0)
+        , _pending(0)
+        , _signal(false, true)
+    {
+        for (uint16_t index = 0; index < Slots; index++) {
+            _entries[index].Sequence.store(index, std::memory_order_relaxed);
+        }
+
+        Thread::Init();
+    }
+
+    TraceUnit::TraceStaging::~TraceStaging()
+    {
+        Stop();
+        _signal.SetEvent();
+        Wait(Thread::BLOCKED | Thread::STOPPED, Core::infinite);
+    }
+
+    bool TraceUnit::TraceStaging::Push(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information)
+    {
+        const char* const names[] = { fileName, information->Module(), information->Category(), className };
+        uint16_t lengths[sizeof(names) / sizeof(const char*)];
+        uint32_t namesLength = 0;
+
+        for (uint8_t index = 0; index < (sizeof(names) / sizeof(const char*)); index++) {
+            lengths[index] = static_cast<uint16_t>(::strlen(names[index]) + 1);
+            namesLength += lengths[index];
+        }
+
+        const uint16_t informationLength = information->Length();
+
+        if ((namesLength + informationLength) > SlotSize) {
+            return (false);
+        }
+
+        uint32_t position = _head.load(std::memory_order_relaxed);
+        Entry* entry = nullptr;
+
+        // Claim a slot: its sequence equals the position while it is free for that round.
+        while (entry == nullptr) {
+            Entry& candidate(_entries[position & (Slots - 1)]);
+            const int32_t difference = static_cast<int32_t>(candidate.Sequence.load(std::memory_order_acquire) - position);
+
+            if (difference == 0) {
+                if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                    entry = &candidate;
+                }
+            } else {
+                if (difference < 0) {
+                    // The ring is full, the drainer can not keep up. Lend it a hand, rather than losing the line.
+                    _parent.Flush();
+                }
+                position = _head.load(std::memory_order_relaxed);
+            }
+        }
+
+        char* data = entry->Data;
+
+        for (uint8_t index = 0; index < (sizeof(names) / sizeof(const char*)); index++) {
+            ::memcpy(data, names[index], lengths[index]);
+            data += lengths[index];
+        }
+        ::memcpy(data, information->Data(), informationLength);
+
+        entry->Time = Core::Time::Now().Ticks();
+        entry->LineNumber = lineNumber;
+        entry->NamesLength = static_cast<uint16_t>(namesLength);
+        entry->InformationLength = informationLength;
+
+        entry->Sequence.store(position + 1, std::memory_order_release);
+
+        if (_pending.fetch_add(1) == 0) {
+            _signal.SetEvent();
+        }
+
+        return (true);
+    }
+
+    void TraceUnit::TraceStaging::Drain(TraceBuffer* output)
+    {
+        Entry* entry = &(_entries[_tail & (Slots - 1)]);
+
+        while (entry->Sequence.load(std::memory_order_acquire) == (_tail + 1)) {
+
+            if (output != nullptr) {
+                Write(*output, entry->Time, entry->LineNumber, entry->Data, entry->NamesLength, &(entry->Data[entry->NamesLength]), entry->InformationLength);
+            }
+
+            // Hand the slot back to the producers, for the next round.
+            entry->Sequence.store(_tail + Slots, std::memory_order_release);
+            _tail++;
+            _pending--;
+
+            entry = &(_entries[_tail & (Slots - 1)]);
+        }
+    }
+
+    /* static */ void TraceUnit::TraceStaging::Write(TraceBuffer& output, const uint64_t time, const uint32_t lineNumber, const char names[], const uint16_t namesLength, const char information[], const uint16_t informationLength)
+    {
+        // Trace entry has been simplified: 16 bit size followed by fields:
+        // length(2 bytes) - clock ticks (8 bytes) - line number (4 bytes) - file/module/category/className
+        const uint16_t headerLength = 2 + 8 + 4 + namesLength;
+
+        const uint32_t fullLength = informationLength + headerLength; // Actual data (no '\0' needed).
+
+        // Tell the buffer how much we are going to write.
+        const uint32_t actualLength = output.Reserve(fullLength);
+
+        if (actualLength >= headerLength) {
+            const uint16_t convertedLength = static_cast<uint16_t>(actualLength);
+            output.Write(reinterpret_cast<const uint8_t*>(&convertedLength), 2);
+            output.Write(reinterpret_cast<const uint8_t*>(&time), 8);
+            output.Write(reinterpret_cast<const uint8_t*>(&lineNumber), 4);
+            output.Write(reinterpret_cast<const uint8_t*>(names), namesLength);
+
+            // Can be partially, if the information does not fit.
+            output.Write(reinterpret_cast<const uint8_t*>(information), actualLength - headerLength);
+        }
+    }
+
+    /* virtual */ uint32_t TraceUnit::TraceStaging::Worker()
+    {
+        // A line might be claimed, but not yet completed, while the ones after it are, so keep an eye on it.
+        _signal.Lock(_pending.load() != 0 ? 1 : Core::infinite);
+        _signal.ResetEvent();
+
+        if (IsRunning() == true) {
+            _parent.Flush();
+        }
+
+        return (0);
+    }
+
     /* static */ TraceUnit& TraceUnit::Instance()
     {
         return (Core::SingletonType<TraceUnit>::Instance());
@@ -153,6 +292,10 @@ namespace Trace {
         }
 
         m_Admin.Unlock();
+
+        if (m_Staging != nullptr) {
+            delete m_Staging;
+        }
     }
 
     uint32_t TraceUnit::Open(const uint32_t identifier)
@@ -197,11 +340,13 @@ namespace Trace {
 
         ASSERT(m_OutputChannel != nullptr);
 
-        if (m_OutputChannel != nullptr) {
-            delete m_OutputChannel;
-        }
+        TraceBuffer* channel = m_OutputChannel.exchange(nullptr);
 
-        m_OutputChannel = nullptr;
+        if (channel != nullptr) {
+            m_Staging->Drain(channel);
+
+            delete channel;
+        }
 
         m_Admin.Unlock();
 
@@ -361,47 +506,9 @@ namespace Trace {
     {
         const char* fileName(Core::FileNameOnly(file));
 
-        m_Admin.Lock();
-
-        if (m_OutputChannel != nullptr) {
-
-            const char* category(information->Category());
-            const char* module(information->Module());
-            const uint64_t current = Core::Time::Now().Ticks();
-            const uint16_t fileNameLength = static_cast<uint16_t>(strlen(fileName) + 1); // File name.
-            const uint16_t moduleLength = static_cast<uint16_t>(strlen(module) + 1); // Module.
-            const uint16_t categoryLength = static_cast<uint16_t>(strlen(category) + 1); // Cateogory.
-            const uint16_t classNameLength = static_cast<uint16_t>(strlen(className) + 1); // Class name.
-            const uint16_t informationLength = information->Length(); // Actual data (no '\0' needed).
-
-            // Trace entry has been simplified: 16 bit size followed by fields:
-            // length(2 bytes) - clock ticks (8 bytes) - line number (4 bytes) - file/module/category/className
-            const uint16_t headerLength = 2 + 8 + 4 + fileNameLength + moduleLength + categoryLength + classNameLength;
-
-            const uint32_t fullLength = informationLength + headerLength; // Actual data (no '\0' needed).
-
-            // Tell the buffer how much we are going to write.
-            const uint32_t actualLength = m_OutputChannel->Reserve(fullLength);
-
-            if (actualLength >= headerLength) {
-                const uint16_t convertedLength = static_cast<uint16_t>(actualLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&convertedLength), 2);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&current), 8);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&lineNumber), 4);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(fileName), fileNameLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(module), moduleLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(category), categoryLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(className), classNameLength);
-
-                if (actualLength >= fullLength) {
-                    // We can write the whole information.
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), informationLength);
-                } else {
-                    // Can only write information partially
-                    const uint16_t dropLength = actualLength - headerLength;
-
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), dropLength);
-                }
+        if (m_OutputChannel.load() != nullptr) {
+            if (m_Staging->Push(fileName, lineNumber, className, information) == false) {
+                Spill(fileName, lineNumber, className, information);
             }
         }
 
@@ -409,11 +516,41 @@ namespace Trace {
             string time(Core::Time::Now().ToRFC1123(true));
             Core::TextFragment cleanClassName(Core::ClassNameOnly(className));
 
+            m_Admin.Lock();
             fprintf(stdout, "[%s]:[%s:%d]:[%s] %s: %s\n", time.c_str(), fileName, lineNumber, cleanClassName.Data(), information->Category(), information->Data());
             fflush(stdout);
+            m_Admin.Unlock();
+        }
+    }
+
+    // A line too big to be staged is written directly, after whatever was staged before it.
+    void TraceUnit::Spill(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information)
+    {
+        m_Admin.Lock();
+
+        TraceBuffer* channel = m_OutputChannel.load();
+
+        m_Staging->Drain(channel);
+
+        if (channel != nullptr) {
+            string names(fileName, ::strlen(fileName) + 1);
+            names.append(information->Module(), ::strlen(information->Module()) + 1);
+            names.append(information->Category(), ::strlen(information->Category()) + 1);
+            names.append(className, ::strlen(className) + 1);
+
+            TraceStaging::Write(*channel, Core::Time::Now().Ticks(), lineNumber, names.c_str(), static_cast<uint16_t>(names.length()), information->Data(), information->Length());
         }
 
         m_Admin.Unlock();
     }
+
+    void TraceUnit::Salvage()
+    {
+        TraceBuffer* channel = m_OutputChannel.load();
+
+        if ((channel != nullptr) && (m_Staging != nullptr)) {
+            m_Staging->Drain(channel);
+        }
+    }
 }
 } // namespace WPEFramework::Trace
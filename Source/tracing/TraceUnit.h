@@ -167,6 +167,58 @@ namespace Trace {
             Core::DoorBell _doorBell;
         };
 
+        // Trace lines are staged in a lock free ring, so tracing threads do not wait on each other nor on
+        // the process wide lock of the cyclic buffer. One thread moves the staged lines to the cyclic buffer.
+        // A slot holds a copy of all names and the text, so it does not depend on the lifetime of the
+        // ITraceControl (or the library) it came from. A line that does not fit a slot is not staged.
+        // Staged lines are lost if the process dies, unless the fatal signal handler calls Salvage().
+        class EXTERNAL TraceStaging : public Core::Thread {
+        private:
+            TraceStaging() = delete;
+            TraceStaging(const TraceStaging&) = delete;
+            TraceStaging& operator=(const TraceStaging&) = delete;
+
+        public:
+            static constexpr uint16_t Slots = 64; // Must be a power of 2.
+            static constexpr uint16_t SlotSize = 1024; // File, module, category and class name and trace text.
+
+            struct Entry {
+                std::atomic<uint32_t> Sequence;
+                uint64_t Time;
+                uint32_t LineNumber;
+                uint16_t NamesLength; // All names, each including its '\0'.
+                uint16_t InformationLength;
+                char Data[SlotSize];
+            };
+
+        public:
+            TraceStaging(TraceUnit& parent);
+            ~TraceStaging();
+
+        public:
+            // Lock free, unless the ring is full, safe to call from any thread. Returns false, without staging
+            // anything, if the line does not fit a slot.
+            bool Push(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information);
+
+            // Single consumer, only to be called with the TraceUnit administration locked.
+            void Drain(TraceBuffer* output);
+
+            // Writes a line to the cyclic buffer, in the format the readers expect. The names are the file, module,
+            // category and class name, each terminated by a '\0', back to back.
+            static void Write(TraceBuffer& output, const uint64_t time, const uint32_t lineNumber, const char names[], const uint16_t namesLength, const char information[], const uint16_t informationLength);
+
+        private:
+            virtual uint32_t Worker() override;
+
+        private:
+            TraceUnit& _parent;
+            Entry _entries[Slots];
+            std::atomic<uint32_t> _head;
+            uint32_t _tail;
+            std::atomic<int32_t> _pending;
+            Core::Event _signal;
+        };
+
     protected:
         TraceUnit();
 
@@ -193,6 +245,10 @@ namespace Trace {
 
         void Trace(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information);
 
+        // Only for a fatal signal handler: moves the staged lines to the cyclic buffer, so they survive the crash.
+        // Best effort, it does not take the lock, as the crashing thread might be holding it.
+        void Salvage();
+
         inline Core::CyclicBuffer* CyclicBuffer()
         {
             return (m_OutputChannel);
@@ -207,19 +263,19 @@ namespace Trace {
         }
         inline void Announce() {
             ASSERT (m_OutputChannel != nullptr);
-            m_OutputChannel->Ring();
+            m_OutputChannel.load()->Ring();
         }
         inline void Acknowledge() {
             ASSERT (m_OutputChannel != nullptr);
-            m_OutputChannel->Acknowledge();
+            m_OutputChannel.load()->Acknowledge();
         }
         inline uint32_t Wait (const uint32_t waitTime) {
             ASSERT (m_OutputChannel != nullptr);
-            return (m_OutputChannel->Wait(waitTime));
+            return (m_OutputChannel.load()->Wait(waitTime));
         }
 		inline void Relinquish() {
             ASSERT(m_OutputChannel != nullptr);
-            return (m_OutputChannel->Relinquish());
+            return (m_OutputChannel.load()->Relinquish());
 		}
 
     private:
@@ -227,19 +283,36 @@ namespace Trace {
         {
             ASSERT(m_OutputChannel == nullptr);
 
-            m_OutputChannel = new TraceBuffer(doorBell, fileName);
+            // Only a process that traces gets the staging thread, a zygote forks without it. It exists before
+            // the channel is published, as Trace() only looks at the channel.
+            if (m_Staging == nullptr) {
+                m_Staging = new TraceStaging(*this);
+            }
+            m_Staging->Run();
+
+            TraceBuffer* channel = new TraceBuffer(doorBell, fileName);
+
+            ASSERT(channel->IsValid() == true);
 
-            ASSERT(m_OutputChannel->IsValid() == true);
+            m_OutputChannel.store(channel);
 
-            return (m_OutputChannel->IsValid() ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+            return (channel->IsValid() ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
         void UpdateEnabledCategories(const Core::JSON::ArrayType<Setting::JSON>& info);
+        void Spill(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information);
+        inline void Flush()
+        {
+            m_Admin.Lock();
+            m_Staging->Drain(m_OutputChannel);
+            m_Admin.Unlock();
+        }
 
         TraceControlList m_Categories;
         Core::CriticalSection m_Admin;
-        TraceBuffer* m_OutputChannel;
+        std::atomic<TraceBuffer*> m_OutputChannel;
         Settings m_EnabledCategories;
         bool m_DirectOut;
+        TraceStaging* m_Staging;
     };
 }
 } // namespace Trace
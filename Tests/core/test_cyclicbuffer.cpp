@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static const char g_cyclicBufferName[] = "testcyclicbuffer01";
+
+    static void CleanUpCyclicBuffer()
+    {
+        Core::File(string(g_cyclicBufferName)).Destroy();
+    }
+
+    TEST(Core_CyclicBuffer, WrapAround)
+    {
+        CleanUpCyclicBuffer();
+
+        {
+            // Not a power of two, and records that do not divide it, so every wrap lands somewhere else.
+            Core::CyclicBuffer buffer(g_cyclicBufferName, 1000, false);
+            ASSERT_TRUE(buffer.IsValid());
+
+            uint8_t input[333];
+            uint8_t peeked[333];
+            uint8_t output[333];
+
+            for (uint32_t round = 0; round < 50; round++) {
+                const uint32_t length = 1 + ((round * 37) % sizeof(input));
+
+                for (uint32_t index = 0; index < length; index++) {
+                    input[index] = static_cast<uint8_t>(round + index);
+                }
+
+                EXPECT_EQ(buffer.Write(input, length), length);
+                EXPECT_EQ(buffer.Used(), length);
+                EXPECT_EQ(buffer.Peek(peeked, length), length);
+                EXPECT_EQ(buffer.Read(output, length), length);
+                EXPECT_EQ(buffer.Used(), 0u);
+                EXPECT_EQ(::memcmp(input, peeked, length), 0);
+                EXPECT_EQ(::memcmp(input, output, length), 0);
+            }
+        }
+
+        CleanUpCyclicBuffer();
+    }
+
+    TEST(Core_CyclicBuffer, SplitReads)
+    {
+        CleanUpCyclicBuffer();
+
+        {
+            Core::CyclicBuffer buffer(g_cyclicBufferName, 1000, false);
+            ASSERT_TRUE(buffer.IsValid());
+
+            uint8_t input[1000];
+            uint8_t output[1000];
+            uint32_t written = 0;
+            uint32_t read = 0;
+
+            // Reads and writes of different sizes, so both copies cross the end of the buffer at different spots.
+            const uint32_t writes[] = { 700, 500, 123, 650, 1, 400 };
+            const uint32_t reads[] = { 300, 850, 10, 500, 314, 400 };
+
+            for (uint32_t step = 0; step < (sizeof(writes) / sizeof(writes[0])); step++) {
+                for (uint32_t index = 0; index < writes[step]; index++) {
+                    input[index] = static_cast<uint8_t>(written + index);
+                }
+                EXPECT_EQ(buffer.Write(input, writes[step]), writes[step]);
+                written += writes[step];
+
+                EXPECT_EQ(buffer.Read(output, reads[step]), reads[step]);
+                for (uint32_t index = 0; index < reads[step]; index++) {
+                    EXPECT_EQ(output[index], static_cast<uint8_t>(read + index));
+                }
+                read += reads[step];
+
+                EXPECT_EQ(buffer.Used(), written - read);
+            }
+        }
+
+        CleanUpCyclicBuffer();
+    }
+
+} // Tests
+} // WPEFramework
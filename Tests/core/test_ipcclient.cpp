@@ -48,5 +48,212 @@ namespace Tests {
         }
         testAdmin.Sync("done testing");
     }
+
+    class FrameMessage : public Core::IMessage {
+    public:
+        FrameMessage(const uint32_t label, const uint32_t sequence)
+            : _label(label)
+            , _sequence(sequence)
+            , _data()
+        {
+        }
+
+    public:
+        std::vector<uint8_t>& Body()
+        {
+            return (_data);
+        }
+        virtual uint32_t Label() const
+        {
+            return (_label);
+        }
+        virtual uint32_t Sequence() const
+        {
+            return (_sequence);
+        }
+        virtual uint32_t Length() const
+        {
+            return (static_cast<uint32_t>(_data.size()));
+        }
+        virtual uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+        {
+            uint16_t result = std::min(maxLength, static_cast<uint16_t>(_data.size() - offset));
+            ::memcpy(stream, &(_data[offset]), result);
+            return (result);
+        }
+        virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+        {
+            _data.resize(offset);
+            _data.insert(_data.end(), stream, stream + maxLength);
+            return (maxLength);
+        }
+
+    private:
+        uint32_t _label;
+        uint32_t _sequence;
+        std::vector<uint8_t> _data;
+    };
+
+    class FrameWriter : public Core::IMessage::Serializer {
+    public:
+        virtual void Serialized(const Core::IMessage&)
+        {
+        }
+    };
+
+    class FrameReader : public Core::IMessage::Deserializer {
+    public:
+        FrameReader()
+            : _message(0, 0)
+            , _identifier()
+            , _frames(0)
+        {
+        }
+
+    public:
+        virtual void Deserialized(Core::IMessage&)
+        {
+            _frames++;
+        }
+        virtual Core::IMessage* Element(const Core::IMessage::Identifier& identifier)
+        {
+            _identifier = identifier;
+            _message.Body().clear();
+            return (&_message);
+        }
+
+    public:
+        FrameMessage _message;
+        Core::IMessage::Identifier _identifier;
+        uint32_t _frames;
+    };
+
+    static std::vector<uint8_t> Frame(FrameMessage& message)
+    {
+        FrameWriter writer;
+        uint8_t buffer[64];
+
+        writer.Submit(message);
+
+        uint16_t length = writer.Serialize(buffer, sizeof(buffer));
+
+        return (std::vector<uint8_t>(buffer, buffer + length));
+    }
+
+    TEST(Core_IPC, FrameLayout)
+    {
+        FrameMessage plain(4, 0);
+        FrameMessage sequenced(4, 5);
+
+        plain.Body() = { 0xAA, 0xBB };
+        sequenced.Body() = { 0xAA, 0xBB };
+
+        // Without a sequence, the frame is laid out as it always was: length, label and the body.
+        const std::vector<uint8_t> old = { 0x03, 0x04, 0xAA, 0xBB };
+        EXPECT_TRUE(Frame(plain) == old);
+
+        // With one, the label is marked and the sequence follows it.
+        const std::vector<uint8_t> tagged = { 0x07, 0x84, 0x80, 0x80, 0x80, 0x05, 0xAA, 0xBB };
+        EXPECT_TRUE(Frame(sequenced) == tagged);
+
+        // Read back a byte at a time, so every part of the header is split.
+        std::vector<uint8_t> stream(old);
+        stream.insert(stream.end(), tagged.begin(), tagged.end());
+
+        FrameReader reader;
+        uint32_t label[2] = {};
+        uint32_t sequence[2] = {};
+
+        for (uint32_t index = 0; index < stream.size(); index++) {
+            const uint32_t frames = reader._frames;
+
+            EXPECT_EQ(reader.Deserialize(&(stream[index]), 1), 1u);
+
+            if ((reader._frames != frames) && (frames < 2)) {
+                label[frames] = reader._identifier.Label;
+                sequence[frames] = reader._identifier.Sequence;
+            }
+        }
+
+        EXPECT_EQ(reader._frames, 2u);
+        EXPECT_EQ(label[0], 4u);
+        EXPECT_EQ(sequence[0], 0u);
+        EXPECT_EQ(label[1], 4u);
+        EXPECT_EQ(sequence[1], 5u);
+        EXPECT_TRUE(reader._message.Body() == std::vector<uint8_t>({ 0xAA, 0xBB }));
+    }
+
+    typedef Core::IPCMessageType<7, Core::IPC::ScalarType<uint32_t>, Core::IPC::ScalarType<uint32_t>> EchoMessage;
+
+    // Echoes the value, after holding on to it for the given number of ms, if it is larger than 1000.
+    class EchoHandler : public Core::IIPCServer {
+    public:
+        virtual void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& data)
+        {
+            Core::ProxyType<EchoMessage> message(Core::proxy_cast<EchoMessage>(data));
+            const uint32_t value = message->Parameters().Value();
+
+            if (value > 1000) {
+                SleepMs(value - 1000);
+            }
+
+            message->Response() = value;
+            source.ReportResponse(data);
+        }
+    };
+
+    TEST(Core_IPC, LateResponse)
+    {
+        Core::NodeId node(_T("/tmp/testlateresponse"));
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+
+        serverFactory->CreateFactory<EchoMessage>(2);
+
+        {
+            Core::IPCChannelServerType<Core::Void, false> server(node, 512, serverFactory);
+            Core::ProxyType<Core::IIPCServer> handler(Core::ProxyType<EchoHandler>::Create());
+
+            server.Register(EchoMessage::Id(), handler);
+            ASSERT_EQ(server.Open(1000), Core::ERROR_NONE);
+
+            {
+                Core::IPCChannelClientType<Core::Void, false, false> client(node, 512, clientFactory);
+
+                ASSERT_EQ(client.Open(1000), Core::ERROR_NONE);
+
+                Core::ProxyType<EchoMessage> first(Core::ProxyType<EchoMessage>::Create());
+                first->Parameters() = 42;
+                EXPECT_EQ(client.Invoke(first, 1000), Core::ERROR_NONE);
+                EXPECT_EQ(first->Response().Value(), 42u);
+
+                // The server tells it reads sequences before it answers anything, so by now calls carry one.
+                Core::ProxyType<EchoMessage> slow(Core::ProxyType<EchoMessage>::Create());
+                slow->Parameters() = 1300;
+                EXPECT_EQ(client.Invoke(slow, 100), Core::ERROR_TIMEDOUT);
+
+                // The next call must get its own response, not the late one.
+                Core::ProxyType<EchoMessage> next(Core::ProxyType<EchoMessage>::Create());
+                next->Parameters() = 7;
+                EXPECT_EQ(client.Invoke(next, 2000), Core::ERROR_NONE);
+                EXPECT_EQ(next->Response().Value(), 7u);
+
+                EXPECT_EQ(client.LateResponses(), 1u);
+
+                client.Close(1000);
+            }
+
+            server.Cleanup();
+            server.Unregister(EchoMessage::Id());
+            server.Close(1000);
+        }
+
+        SleepMs(200);
+        serverFactory->DestroyFactories();
+        clientFactory->DestroyFactories();
+        Core::Singleton::Dispose();
+    }
+
 } // Tests
 } // WPEFramework
@@ -749,6 +749,486 @@ namespace Tests {
         ExecutePrimitiveJsonTest<Core::JSON::EnumType<JSONTestEnum>>(data, false, nullptr);
     }
 
+    // Wide enough for the container to look its labels up in the index of the class.
+    class IndexedJson : public TestCaseBase, public Core::JSON::Container {
+    public:
+        static constexpr uint16_t Fields = 10;
+
+        enum layout {
+            NORMAL,
+            EXTENDED,
+            REDUCED,
+            REVERSED,
+            DUPLICATED
+        };
+
+    public:
+        IndexedJson(const IndexedJson&) = delete;
+        IndexedJson& operator=(const IndexedJson&) = delete;
+
+        explicit IndexedJson(const layout fields)
+            : Core::JSON::Container()
+            , _values(Fields)
+            , _extra()
+        {
+            if (fields == EXTENDED) {
+                Add(_T("extra"), &_extra);
+            }
+            for (uint16_t index = 0; index < Fields; index++) {
+                const uint16_t field = (fields == REVERSED ? (Fields - 1 - index) : index);
+
+                if ((fields != REDUCED) || (field != 0)) {
+                    Add(Label(field).c_str(), &(_values[field]));
+                }
+            }
+            if (fields == DUPLICATED) {
+                Add(Label(3).c_str(), &_extra);
+            }
+        }
+        ~IndexedJson() override {}
+
+        static const std::string& Label(const uint16_t index)
+        {
+            static const std::vector<std::string> labels = []() {
+                std::vector<std::string> result;
+                for (uint16_t field = 0; field < Fields; field++) {
+                    result.push_back("field_" + std::to_string(field));
+                }
+                return (result);
+            }();
+
+            return (labels[index]);
+        }
+        static std::string Text()
+        {
+            std::stringstream text;
+
+            text << "{";
+            for (uint16_t index = Fields; index > 0; index--) {
+                text << "\"" << Label(index - 1) << "\":" << index << (index > 1 ? "," : "");
+            }
+            text << "}";
+
+            return (text.str());
+        }
+
+        const Core::JSON::DecUInt32& Value(const uint16_t index) const
+        {
+            return (_values[index]);
+        }
+        const Core::JSON::DecUInt32& Extra() const
+        {
+            return (_extra);
+        }
+
+    private:
+        std::vector<Core::JSON::DecUInt32> _values;
+        Core::JSON::DecUInt32 _extra;
+    };
+
+    TEST(JSONParser, IndexedContainer)
+    {
+        IndexedJson test(IndexedJson::NORMAL);
+        Execute<IndexedJson>(test, IndexedJson::Text(), true);
+
+        for (uint16_t index = 0; index < IndexedJson::Fields; index++) {
+            EXPECT_EQ(test.Value(index).Value(), index + 1u);
+        }
+    }
+
+    TEST(JSONParser, IndexedContainerDeviatingFields)
+    {
+        // The first instance sets up the index of the class, the others have a different set of fields.
+        IndexedJson normal(IndexedJson::NORMAL);
+        Execute<IndexedJson>(normal, IndexedJson::Text(), true);
+
+        IndexedJson extended(IndexedJson::EXTENDED);
+        Execute<IndexedJson>(extended, "{\"extra\":42," + IndexedJson::Text().substr(1), true);
+        EXPECT_EQ(extended.Extra().Value(), 42u);
+
+        IndexedJson reduced(IndexedJson::REDUCED);
+        Execute<IndexedJson>(reduced, IndexedJson::Text(), true);
+        EXPECT_FALSE(reduced.Value(0).IsSet());
+
+        // Same number of fields, but none of them at the position the index of the class has.
+        IndexedJson reversed(IndexedJson::REVERSED);
+        Execute<IndexedJson>(reversed, IndexedJson::Text(), true);
+
+        for (uint16_t index = 0; index < IndexedJson::Fields; index++) {
+            EXPECT_EQ(extended.Value(index).Value(), index + 1u);
+            EXPECT_EQ(reversed.Value(index).Value(), index + 1u);
+
+            if (index != 0) {
+                EXPECT_EQ(reduced.Value(index).Value(), index + 1u);
+            }
+        }
+    }
+
+    TEST(JSONParser, IndexedContainerDuplicateLabels)
+    {
+        IndexedJson normal(IndexedJson::NORMAL);
+        Execute<IndexedJson>(normal, IndexedJson::Text(), true);
+
+        // Like the scan, the first field with the label gets the value.
+        IndexedJson test(IndexedJson::DUPLICATED);
+        Execute<IndexedJson>(test, IndexedJson::Text(), true);
+
+        EXPECT_EQ(test.Value(3).Value(), 4u);
+        EXPECT_FALSE(test.Extra().IsSet());
+    }
+
+    TEST(JSONParser, IndexedContainerUnknownLabel)
+    {
+        IndexedJson test(IndexedJson::NORMAL);
+        Execute<IndexedJson>(test, "{\"field_1\":2,\"unknown\":7,\"field_10\":8,\"field_9\":10}", true);
+
+        EXPECT_EQ(test.Value(1).Value(), 2u);
+        EXPECT_EQ(test.Value(9).Value(), 10u);
+        EXPECT_FALSE(test.Value(0).IsSet());
+        EXPECT_FALSE(test.Extra().IsSet());
+    }
+
+    class PointJson : public Core::JSON::Container {
+    public:
+        PointJson()
+            : Core::JSON::Container()
+            , X(0)
+            , Y(0)
+        {
+            Add(_T("x"), &X);
+            Add(_T("y"), &Y);
+        }
+        PointJson(const PointJson& copy)
+            : Core::JSON::Container()
+            , X(copy.X)
+            , Y(copy.Y)
+        {
+            Add(_T("x"), &X);
+            Add(_T("y"), &Y);
+        }
+        ~PointJson() override {}
+
+        PointJson& operator=(const PointJson&) = delete;
+
+    public:
+        Core::JSON::DecUInt32 X;
+        Core::JSON::DecUInt32 Y;
+    };
+
+    TEST(JSONParser, ContainerClearResetsNull)
+    {
+        PointJson point;
+
+        // A cleared container, e.g. one that is reused, no longer reports it was null.
+        EXPECT_TRUE(point.FromString(_T("null")));
+        EXPECT_TRUE(point.IsNull());
+
+        point.Clear();
+        EXPECT_FALSE(point.IsNull());
+
+        EXPECT_TRUE(point.FromString(_T("{\"x\":1}")));
+        EXPECT_FALSE(point.IsNull());
+        EXPECT_EQ(point.X.Value(), 1u);
+    }
+
+    template <typename ELEMENT>
+    void ExecuteArrayRoundTrip(const uint16_t elements, const std::function<void(ELEMENT&, const uint16_t)>& fill, const std::function<void(const ELEMENT&, const uint16_t)>& verify)
+    {
+        Core::JSON::ArrayType<ELEMENT> source;
+        std::vector<ELEMENT*> added;
+
+        // Elements are filled in after all of them are added, so the references handed out by Add() must
+        // survive the growth of the array.
+        for (uint16_t index = 0; index < elements; index++) {
+            added.push_back(&(source.Add()));
+        }
+        for (uint16_t index = 0; index < elements; index++) {
+            fill(*(added[index]), index);
+        }
+
+        std::string text;
+        std::vector<uint8_t> packed;
+        source.ToString(text);
+        EXPECT_TRUE(source.IMessagePack::ToBuffer(packed));
+
+        Core::JSON::ArrayType<ELEMENT> parsed;
+        EXPECT_TRUE(parsed.FromString(text));
+        Core::JSON::ArrayType<ELEMENT> unpacked;
+        EXPECT_TRUE(unpacked.IMessagePack::FromBuffer(packed));
+
+        ASSERT_EQ(parsed.Length(), elements);
+        ASSERT_EQ(unpacked.Length(), elements);
+
+        for (uint16_t index = 0; index < elements; index++) {
+            verify(parsed[index], index);
+            verify(unpacked[index], index);
+        }
+
+        std::string result;
+        unpacked.ToString(result);
+        EXPECT_EQ(result, text);
+    }
+
+    TEST(JSONParser, ArrayRoundTrip)
+    {
+        ExecuteArrayRoundTrip<Core::JSON::DecUInt32>(
+            1000, [](Core::JSON::DecUInt32& element, const uint16_t index) { element = (index * 7) + 1; },
+            [](const Core::JSON::DecUInt32& element, const uint16_t index) { EXPECT_EQ(element.Value(), (index * 7u) + 1); });
+        ExecuteArrayRoundTrip<PointJson>(
+            200, [](PointJson& element, const uint16_t index) { element.X = index + 1; element.Y = (index * 3) + 1; },
+            [](const PointJson& element, const uint16_t index) { EXPECT_EQ(element.X.Value(), index + 1u); EXPECT_EQ(element.Y.Value(), (index * 3u) + 1); });
+        ExecuteArrayRoundTrip<Core::JSON::DecUInt32>(
+            0, [](Core::JSON::DecUInt32&, const uint16_t) {}, [](const Core::JSON::DecUInt32&, const uint16_t) {});
+    }
+
+    TEST(JSONParser, ArrayMessagePackHeader)
+    {
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> target;
+
+        // A map, a string and a boolean are no array, nothing should be taken from the stream.
+        for (const uint8_t header : { 0x81, 0xA3, 0xC3 }) {
+            const uint8_t stream[] = { header, 0x01, 0x02, 0x03 };
+            uint16_t offset = 0;
+
+            EXPECT_EQ(static_cast<Core::JSON::IMessagePack&>(target).Deserialize(stream, sizeof(stream), offset), 0);
+            EXPECT_EQ(offset, 0);
+            EXPECT_EQ(target.Length(), 0);
+        }
+
+        // A fixed array of 2 and an array 16 of 3.
+        const uint8_t fixed[] = { 0x92, 0x05, 0x06 };
+        uint16_t offset = 0;
+        EXPECT_EQ(static_cast<Core::JSON::IMessagePack&>(target).Deserialize(fixed, sizeof(fixed), offset), sizeof(fixed));
+        EXPECT_EQ(offset, 0);
+        ASSERT_EQ(target.Length(), 2);
+        EXPECT_EQ(target[1].Value(), 6u);
+
+        target.Clear();
+        const uint8_t wide[] = { 0xDC, 0x00, 0x03, 0x07, 0x08, 0x09 };
+        EXPECT_EQ(static_cast<Core::JSON::IMessagePack&>(target).Deserialize(wide, sizeof(wide), offset), sizeof(wide));
+        EXPECT_EQ(offset, 0);
+        ASSERT_EQ(target.Length(), 3);
+        EXPECT_EQ(target[2].Value(), 9u);
+    }
+
+    TEST(JSONParser, Scanners)
+    {
+        // Put the character of interest at every position, around the 16 byte blocks.
+        for (uint16_t length = 0; length < 40; length++) {
+            for (uint16_t position = 0; position <= length; position++) {
+                std::string plain(length, 'a');
+                std::string white(length, ' ');
+
+                for (uint16_t index = 0; index < length; index++) {
+                    white[index] = " \t\n\v\f\r"[index % 6];
+                }
+                if (position < length) {
+                    plain[position] = "\"\\\n\x01"[position % 4];
+                    white[position] = "a\x08\x0E\0"[position % 4];
+                }
+
+                EXPECT_EQ(Core::JSON::ScanPlain(plain.c_str(), length), position);
+                EXPECT_EQ(Core::JSON::ScanWhiteSpace(white.c_str(), length), position);
+            }
+        }
+
+        // UTF-8 is plain text.
+        EXPECT_EQ(Core::JSON::ScanPlain("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\"", 19), 18);
+    }
+
+    class BlobJson : public Core::JSON::Container {
+    public:
+        BlobJson(const BlobJson&) = delete;
+        BlobJson& operator=(const BlobJson&) = delete;
+
+        BlobJson()
+            : Core::JSON::Container()
+            , Name()
+            , Data()
+            , Config(false)
+        {
+            Add(_T("name"), &Name);
+            Add(_T("data"), &Data);
+            Add(_T("config"), &Config);
+        }
+        ~BlobJson() override {}
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::String Data;
+        Core::JSON::String Config;
+    };
+
+    TEST(JSONParser, StringScanning)
+    {
+        std::string blob;
+        std::string config("{\n");
+
+        // A base64 blob and an indented, opaque, configuration object.
+        for (uint32_t index = 0; index < 3000; index++) {
+            blob += "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[(index * 37) % 64];
+        }
+        for (uint32_t index = 0; index < 20; index++) {
+            config += "                \"key" + std::to_string(index) + "\": \"value " + std::to_string(index) + "\",\n";
+        }
+        config += "                \"last\": true\n}";
+
+        // Characters that need escaping right before, on and after the 16 byte blocks of the scanner.
+        std::string name;
+        std::string escaped;
+        for (uint16_t index = 0; index < 40; index++) {
+            name += std::string(index % 17, 'n');
+            escaped += std::string(index % 17, 'n');
+            switch (index % 4) {
+            case 0: name += '"'; escaped += "\\\""; break;
+            case 1: name += '\\'; escaped += "\\\\"; break;
+            case 2: name += '\n'; escaped += "\\n"; break;
+            default: name += '\t'; escaped += "\\t"; break;
+            }
+        }
+
+        const std::string text("{\"name\":\"" + escaped + "\",\"data\":\"" + blob + "\",\n    \"config\": " + config + "}");
+        // Only quotes are escaped when it is written.
+        std::string quoted;
+        for (const char character : name) {
+            quoted += (character == '"' ? std::string("\\\"") : std::string(1, character));
+        }
+        const std::string expected("{\"name\":\"" + quoted + "\",\"data\":\"" + blob + "\",\"config\":" + config + "}");
+
+        BlobJson object;
+        std::string serialized;
+        EXPECT_TRUE(object.FromString(text));
+        EXPECT_EQ(object.Name.Value(), name);
+        EXPECT_EQ(object.Data.Value(), blob);
+        EXPECT_EQ(object.Config.Value(), config);
+        object.ToString(serialized);
+        EXPECT_EQ(serialized, expected);
+
+        // Pulled through a small window, so runs of plain text are cut off halfway.
+        char buffer[13];
+        uint16_t offset = 0;
+        serialized.clear();
+        do {
+            const uint16_t loaded = static_cast<const Core::JSON::IElement&>(object).Serialize(buffer, sizeof(buffer), offset);
+            serialized.append(buffer, loaded);
+        } while (offset != 0);
+        EXPECT_EQ(serialized, expected);
+
+        // And the other way around.
+        BlobJson chunked;
+        Core::OptionalType<Core::JSON::Error> error;
+        uint32_t position = 0;
+        offset = 0;
+        do {
+            const uint16_t size = static_cast<uint16_t>(std::min(static_cast<size_t>(sizeof(buffer)), text.length() - position));
+            position += static_cast<Core::JSON::IElement&>(chunked).Deserialize(&(text[position]), size, offset, error);
+        } while ((offset != 0) && (error.IsSet() == false));
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_EQ(position, text.length());
+        EXPECT_EQ(chunked.Name.Value(), name);
+        EXPECT_EQ(chunked.Data.Value(), blob);
+        EXPECT_EQ(chunked.Config.Value(), config);
+    }
+
+    TEST(JSONParser, Generator)
+    {
+        const uint32_t elements = 1000;
+        Core::JSON::ArrayType<PointJson> stored;
+        Core::JSON::GeneratorType<PointJson> generated([elements](const uint32_t index, PointJson& element) -> bool {
+            element.X = index + 1;
+            element.Y = (index * 3) + 1;
+            return (index < elements);
+        });
+
+        for (uint32_t index = 0; index < elements; index++) {
+            PointJson& element(stored.Add());
+            element.X = index + 1;
+            element.Y = (index * 3) + 1;
+        }
+
+        std::string expected;
+        std::string result;
+        stored.ToString(expected);
+        generated.ToString(result);
+        EXPECT_EQ(result, expected);
+
+        // Pulled through a small window, as into the send buffer of a channel.
+        char buffer[7];
+        uint16_t offset = 0;
+        result.clear();
+        do {
+            const uint16_t loaded = static_cast<const Core::JSON::IElement&>(generated).Serialize(buffer, sizeof(buffer), offset);
+            result.append(buffer, loaded);
+        } while (offset != 0);
+        EXPECT_EQ(result, expected);
+
+        std::vector<uint8_t> packed;
+        Core::JSON::ArrayType<PointJson> unpacked;
+        EXPECT_TRUE(generated.IMessagePack::ToBuffer(packed));
+        EXPECT_TRUE(unpacked.IMessagePack::FromBuffer(packed));
+        unpacked.ToString(result);
+        EXPECT_EQ(result, expected);
+
+        Core::JSON::GeneratorType<PointJson> empty([](const uint32_t, PointJson&) -> bool { return (false); });
+        empty.ToString(result);
+        EXPECT_EQ(result, "[]");
+    }
+
+    TEST(JSONParser, GeneratorRunsOnce)
+    {
+        // A source that changes every time it is asked for an element.
+        uint32_t calls = 0;
+        Core::JSON::GeneratorType<PointJson> generated;
+        generated = [&calls](const uint32_t index, PointJson& element) -> bool {
+            calls++;
+            element.X = calls;
+            element.Y = index;
+            return (index < 20);
+        };
+
+        // Measured first and written next, as an HTTP body is, both should agree.
+        std::string measured;
+        std::string result;
+        generated.ToString(measured);
+        EXPECT_EQ(calls, 21u);
+        generated.ToString(result);
+        EXPECT_EQ(result, measured);
+
+        char buffer[7];
+        uint16_t offset = 0;
+        result.clear();
+        do {
+            const uint16_t loaded = static_cast<const Core::JSON::IElement&>(generated).Serialize(buffer, sizeof(buffer), offset);
+            result.append(buffer, loaded);
+        } while (offset != 0);
+        EXPECT_EQ(result, measured);
+        EXPECT_EQ(calls, 21u);
+
+        // MessagePack records its own elements, once.
+        std::vector<uint8_t> packed;
+        std::vector<uint8_t> repacked;
+        EXPECT_TRUE(generated.IMessagePack::ToBuffer(packed));
+        EXPECT_EQ(calls, 42u);
+        EXPECT_TRUE(generated.IMessagePack::ToBuffer(repacked));
+        EXPECT_EQ(calls, 42u);
+        EXPECT_TRUE(packed == repacked);
+
+        Core::JSON::ArrayType<PointJson> unpacked;
+        EXPECT_TRUE(unpacked.IMessagePack::FromBuffer(packed));
+        ASSERT_EQ(unpacked.Length(), 20);
+        EXPECT_EQ(unpacked[0].X.Value(), 22u);
+        EXPECT_EQ(unpacked[19].Y.Value(), 19u);
+
+        // A new generator starts all over.
+        generated = [](const uint32_t index, PointJson& element) -> bool {
+            element.X = 1;
+            element.Y = 2;
+            return (index < 1);
+        };
+        generated.ToString(result);
+        EXPECT_EQ(result, "[{\"x\":1,\"y\":2}]");
+    }
+
 } // Tests
 
 ENUM_CONVERSION_BEGIN(Tests::JSONTestEnum){ WPEFramework::Tests::JSONTestEnum::ONE, _TXT("one") },
@@ -0,0 +1,322 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Typical traffic on the Controller JSON-RPC interface: a call, its response and an event.
+    static const char* g_controllerMessages[] = {
+        R"({"jsonrpc":"2.0","id":1000,"method":"Controller.1.activate","params":{"callsign":"WebKitBrowser"}})",
+        R"({"jsonrpc":"2.0","id":1001,"method":"Controller.1.status@WebKitBrowser"})",
+        R"({"jsonrpc":"2.0","id":1001,"result":[{"callsign":"WebKitBrowser","locator":"libWPEFrameworkWebKitBrowser.so","classname":"WebKitImplementation","autostart":false,"precondition":["Internet"],"state":"activated","processedrequests":2,"processedobjects":0,"observers":0,"module":"WebKitBrowser","hash":"engineering_build_for_debugging_purpose_only"}]})",
+        R"({"jsonrpc":"2.0","method":"client.events.1.statechange","params":{"callsign":"WebKitBrowser","state":"activated","reason":"Requested"}})"
+    };
+
+    TEST(Core_JSONRPC, MessagePackRoundTrip)
+    {
+        for (const char* text : g_controllerMessages) {
+            Core::JSONRPC::Message input;
+            Core::JSONRPC::Message output;
+            std::vector<uint8_t> packed;
+            string result;
+
+            input.FromString(string(text));
+            EXPECT_TRUE(input.IMessagePack::ToBuffer(packed));
+            EXPECT_TRUE(output.IMessagePack::FromBuffer(packed));
+
+            output.ToString(result);
+            EXPECT_STREQ(result.c_str(), text);
+        }
+    }
+
+    class DeviceName : public Core::JSON::Container {
+    public:
+        DeviceName(const DeviceName&) = delete;
+        DeviceName& operator=(const DeviceName&) = delete;
+
+        DeviceName()
+            : Core::JSON::Container()
+            , Name()
+            , Index(0)
+        {
+            Add(_T("name"), &Name);
+            Add(_T("index"), &Index);
+        }
+        ~DeviceName() override
+        {
+        }
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::DecUInt32 Index;
+    };
+
+    TEST(Core_JSONRPC, TypedParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, std::vector<uint8_t>({ 1 }));
+        const DeviceName* received = nullptr;
+
+        handler.Register<DeviceName, DeviceName>(_T("rename"), [&received](const DeviceName& inbound, DeviceName& outbound) -> uint32_t {
+            received = &inbound;
+            outbound.Name = inbound.Name.Value() + _T("!");
+            outbound.Index = inbound.Index.Value() + 1;
+            return (Core::ERROR_NONE);
+        });
+
+        const string request(R"({"jsonrpc":"2.0","id":3,"method":"Device.1.rename","params":{"name":"a \"quoted\" name","index":41}})");
+
+        // Through the message payloads, the parameters are deserialized in the typed object from the request.
+        Core::JSONRPC::Message message;
+        Core::JSONRPC::Message response;
+        uint16_t offset = 0;
+
+        message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+        static_cast<Core::JSON::IElement&>(message).Deserialize(request.c_str(), static_cast<uint16_t>(request.length()), offset);
+
+        ASSERT_TRUE(message.Parameters.IsAttached());
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 3), message.Designator.Value(), message.Parameters, response.Result), Core::ERROR_NONE);
+        EXPECT_EQ(received, message.Parameters.Element().operator->());
+        EXPECT_TRUE(response.Result.IsAttached());
+        EXPECT_STREQ(response.Result.Value().c_str(), R"({"name":"a \"quoted\" name!","index":42})");
+
+        // Through text, as before, the outcome is the same.
+        string result;
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 3), _T("Device.1.rename"), R"({"name":"plain","index":1})", result), Core::ERROR_NONE);
+        EXPECT_STREQ(result.c_str(), R"({"name":"plain!","index":2})");
+    }
+
+    TEST(Core_JSONRPC, PooledParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, std::vector<uint8_t>({ 1 }));
+
+        // Parameters and results come from a pool, the second call must not see what the first one left behind.
+        handler.Register<DeviceName, DeviceName>(_T("echo"), [](const DeviceName& inbound, DeviceName& outbound) -> uint32_t {
+            outbound.Name = inbound.Name.Value();
+            if (inbound.Index.IsSet() == true) {
+                outbound.Index = inbound.Index.Value();
+            }
+            return (Core::ERROR_NONE);
+        });
+
+        const string requests[] = {
+            R"({"jsonrpc":"2.0","id":1,"method":"Device.1.echo","params":{"name":"first","index":1}})",
+            R"({"jsonrpc":"2.0","id":2,"method":"Device.1.echo","params":{"name":"second"}})"
+        };
+        const string expected[] = {
+            R"({"name":"first","index":1})",
+            R"({"name":"second"})"
+        };
+
+        for (uint8_t index = 0; index < 2; index++) {
+            Core::JSONRPC::Message message;
+            Core::JSONRPC::Message response;
+            uint16_t offset = 0;
+
+            message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+            static_cast<Core::JSON::IElement&>(message).Deserialize(requests[index].c_str(), static_cast<uint16_t>(requests[index].length()), offset);
+
+            EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, index), message.Designator.Value(), message.Parameters, response.Result), Core::ERROR_NONE);
+            EXPECT_STREQ(response.Result.Value().c_str(), expected[index].c_str());
+        }
+    }
+
+    class CountedName : public DeviceName {
+    public:
+        CountedName(const CountedName&) = delete;
+        CountedName& operator=(const CountedName&) = delete;
+
+        CountedName()
+            : DeviceName()
+        {
+            _instances++;
+        }
+        ~CountedName() override
+        {
+            _instances--;
+        }
+
+    public:
+        static uint32_t Instances()
+        {
+            return (_instances);
+        }
+
+    private:
+        static std::atomic<uint32_t> _instances;
+    };
+
+    std::atomic<uint32_t> CountedName::_instances(0);
+
+    TEST(Core_JSONRPC, RecycledResults)
+    {
+        const string request(R"({"jsonrpc":"2.0","id":1,"method":"Device.1.name"})");
+        Core::JSONRPC::Message call;
+        call.FromString(request);
+
+        Core::JSONRPC::Handler* handler = new Core::JSONRPC::Handler([](const uint32_t, const string&, const string&) {}, std::vector<uint8_t>({ 1 }));
+        handler->Register<void, CountedName>(_T("name"), [](CountedName& outbound) -> uint32_t {
+            outbound.Name = _T("counted");
+            return (Core::ERROR_NONE);
+        });
+
+        {
+            std::list<Core::JSONRPC::Message> responses;
+
+            for (uint8_t index = 0; index < 10; index++) {
+                responses.emplace_back();
+                EXPECT_EQ(handler->Invoke(Core::JSONRPC::Connection(1, index), call.Designator.Value(), call.Parameters, responses.back().Result), Core::ERROR_NONE);
+            }
+            EXPECT_EQ(CountedName::Instances(), 10u);
+        }
+
+        // Only a few are kept for the next calls.
+        EXPECT_EQ(CountedName::Instances(), 4u);
+
+        // A result that is still out when the handler is gone stays valid, and so does its recycler.
+        Core::JSONRPC::Message response;
+        EXPECT_EQ(handler->Invoke(Core::JSONRPC::Connection(1, 10), call.Designator.Value(), call.Parameters, response.Result), Core::ERROR_NONE);
+        EXPECT_EQ(CountedName::Instances(), 4u);
+
+        delete handler;
+
+        EXPECT_EQ(CountedName::Instances(), 4u);
+        EXPECT_STREQ(response.Result.Value().c_str(), R"({"name":"counted"})");
+
+        response.Result.Clear();
+        EXPECT_EQ(CountedName::Instances(), 0u);
+    }
+
+    TEST(Core_JSONRPC, MismatchedParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, std::vector<uint8_t>({ 1 }));
+        uint32_t calls = 0;
+
+        handler.Register<DeviceName, DeviceName>(_T("rename"), [&calls](const DeviceName&, DeviceName&) -> uint32_t {
+            calls++;
+            return (Core::ERROR_NONE);
+        });
+
+        // The parameters do not fit the typed object, the rest of the request must still be read.
+        const string requests[] = {
+            R"({"jsonrpc":"2.0","method":"Device.1.rename","params":{"name":"a","index":"x{]\"y"},"id":7})",
+            R"({"jsonrpc":"2.0","method":"Device.1.rename","params":[1,{"a":"}"}],"id":7})",
+            R"({"jsonrpc":"2.0","method":"Device.1.rename","params":"text","id":7})",
+            R"({"jsonrpc":"2.0","method":"Device.1.rename","params":12 ,"id":7})"
+        };
+
+        for (const string& request : requests) {
+            Core::JSONRPC::Message message;
+            Core::JSONRPC::Message response;
+            Core::OptionalType<Core::JSON::Error> error;
+            uint16_t offset = 0;
+
+            message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+            static_cast<Core::JSON::IElement&>(message).Deserialize(request.c_str(), static_cast<uint16_t>(request.length()), offset, error);
+
+            EXPECT_FALSE(error.IsSet()) << request;
+            EXPECT_TRUE(message.Parameters.IsMismatched()) << request;
+            EXPECT_EQ(message.Id.Value(), 7u) << request;
+            EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 7), message.FullMethod(), message.Parameters, response.Result), Core::ERROR_INVALID_SIGNATURE);
+
+            // Frames arrive in pieces, the parameters are skipped over several calls.
+            Core::JSONRPC::Message chunked;
+            uint16_t position = 0;
+
+            offset = 0;
+            chunked.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+
+            do {
+                const uint16_t length = std::min(static_cast<uint16_t>(3), static_cast<uint16_t>(request.length() - position));
+                position += static_cast<Core::JSON::IElement&>(chunked).Deserialize(&(request.c_str()[position]), length, offset, error);
+            } while ((offset != 0) && (error.IsSet() == false) && (position < request.length()));
+
+            EXPECT_FALSE(error.IsSet()) << request;
+            EXPECT_TRUE(chunked.Parameters.IsMismatched()) << request;
+            EXPECT_EQ(chunked.Id.Value(), 7u) << request;
+        }
+
+        // The same message, reused for a request that does fit, is not mismatched anymore.
+        Core::JSONRPC::Message message;
+        Core::JSONRPC::Message response;
+        uint16_t offset = 0;
+        const string valid(R"({"jsonrpc":"2.0","method":"Device.1.rename","params":{"name":"a","index":1},"id":8})");
+
+        message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+        static_cast<Core::JSON::IElement&>(message).Deserialize(requests[0].c_str(), static_cast<uint16_t>(requests[0].length()), offset);
+        EXPECT_TRUE(message.Parameters.IsMismatched());
+
+        message.Clear();
+        message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+        offset = 0;
+        static_cast<Core::JSON::IElement&>(message).Deserialize(valid.c_str(), static_cast<uint16_t>(valid.length()), offset);
+        EXPECT_FALSE(message.Parameters.IsMismatched());
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 8), message.FullMethod(), message.Parameters, response.Result), Core::ERROR_NONE);
+        EXPECT_EQ(calls, 1u);
+
+        // And so it is, when it arrives in pieces.
+        Core::OptionalType<Core::JSON::Error> error;
+        uint16_t position = 0;
+
+        message.Clear();
+        message.Resolve([&handler](const string& designator) { return (handler.Parameters(designator)); });
+        offset = 0;
+
+        do {
+            const uint16_t length = std::min(static_cast<uint16_t>(3), static_cast<uint16_t>(valid.length() - position));
+            position += static_cast<Core::JSON::IElement&>(message).Deserialize(&(valid.c_str()[position]), length, offset, error);
+        } while ((offset != 0) && (error.IsSet() == false) && (position < valid.length()));
+
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_FALSE(message.Parameters.IsMismatched());
+        EXPECT_TRUE(message.Parameters.IsAttached());
+        EXPECT_EQ(message.Id.Value(), 8u);
+    }
+
+    TEST(Core_JSONRPC, HandlerReceivesFullMethod)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, std::vector<uint8_t>({ 1 }));
+        string received;
+
+        handler.Register(_T("status"), [&received](const string& method, const string&, string& response) -> uint32_t {
+            received = method;
+            response = _T("{}");
+            return (Core::ERROR_NONE);
+        });
+
+        Core::JSONRPC::Message message;
+        message.FromString(string(R"({"jsonrpc":"2.0","id":1,"method":"Controller.1.status@WebKitBrowser"})"));
+
+        // The handler is found on the method alone, but it gets what it was invoked with, index included.
+        string response;
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 1), message.FullMethod(), string(), response), Core::ERROR_NONE);
+        EXPECT_STREQ(received.c_str(), _T("status@WebKitBrowser"));
+
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 2), _T("status"), string(), response), Core::ERROR_NONE);
+        EXPECT_STREQ(received.c_str(), _T("status"));
+
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 3), _T("state@WebKitBrowser"), string(), response), Core::ERROR_UNKNOWN_KEY);
+    }
+
+    TEST(Core_JSONRPC, MessagePackRepacked)
+    {
+        for (const char* text : g_controllerMessages) {
+            Core::JSONRPC::Message message;
+            std::vector<uint8_t> packed;
+
+            message.FromString(string(text));
+            EXPECT_TRUE(message.IMessagePack::ToBuffer(packed));
+
+            // The binary form is the smaller one, and decoding and encoding it again yields the same bytes.
+            EXPECT_LT(packed.size(), strlen(text));
+
+            Core::JSONRPC::Message decoded;
+            std::vector<uint8_t> repacked;
+
+            EXPECT_TRUE(decoded.IMessagePack::FromBuffer(packed));
+            EXPECT_TRUE(decoded.IMessagePack::ToBuffer(repacked));
+            EXPECT_TRUE(repacked == packed);
+        }
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static bool Contains(Core::ProcessInfo::Iterator index, const uint32_t pid)
+    {
+        while (index.Next() == true) {
+            if (index.Current().Id() == pid) {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+    // Process events reach the table asynchronously, give them a moment.
+    template <typename ITERATOR>
+    static bool Eventually(ITERATOR iterator, const uint32_t pid, const bool present)
+    {
+        uint8_t attempts = 100;
+
+        while ((Contains(iterator(), pid) != present) && (--attempts != 0)) {
+            ::usleep(10000);
+        }
+        return (attempts != 0);
+    }
+
+    // Before any other lookup, so the zombie is there when the table is filled from /proc.
+    TEST(Core_ProcessInfo, ReapedZombie)
+    {
+        Core::ProcessInfo myself;
+        pid_t child = ::fork();
+
+        if (child == 0) {
+            ::_exit(0);
+        }
+
+        ASSERT_GT(child, 0);
+
+        const uint32_t id = static_cast<uint32_t>(child);
+        siginfo_t info;
+
+        // Turned into a zombie, but not reaped.
+        ASSERT_EQ(::waitid(P_PID, child, &info, WEXITED | WNOWAIT), 0);
+
+        Contains(myself.Children(), id);
+
+        ::waitpid(child, nullptr, 0);
+
+        EXPECT_TRUE(Eventually([&myself]() { return (myself.Children()); }, id, false));
+    }
+
+    static void* Worker(void* argument)
+    {
+        const int descriptor = *static_cast<int*>(argument);
+        char buffer;
+
+        while (::read(descriptor, &buffer, 1) > 0) {
+        }
+        ::_exit(0);
+
+        return (nullptr);
+    }
+
+    TEST(Core_ProcessInfo, LeaderExit)
+    {
+        Core::ProcessInfo myself;
+        int channel[2];
+
+        ASSERT_EQ(::pipe(channel), 0);
+
+        // Make sure the table is in use before the child is there.
+        Contains(myself.Children(), 0);
+
+        pid_t child = ::fork();
+
+        if (child == 0) {
+            pthread_t worker;
+
+            ::close(channel[1]);
+            if (::pthread_create(&worker, nullptr, Worker, &channel[0]) != 0) {
+                ::_exit(1);
+            }
+            // The leading thread is gone, the process lives on in its worker. Not through
+            // pthread_exit, that unwinds the stack, right into the test framework.
+            ::syscall(SYS_exit, 0);
+        }
+
+        ASSERT_GT(child, 0);
+        ::close(channel[0]);
+
+        const uint32_t id = static_cast<uint32_t>(child);
+
+        EXPECT_TRUE(Eventually([&myself]() { return (myself.Children()); }, id, true));
+
+        ::usleep(200000);
+
+        EXPECT_TRUE(Contains(myself.Children(), id));
+
+        ::close(channel[1]);
+        ::waitpid(child, nullptr, 0);
+
+        EXPECT_TRUE(Eventually([&myself]() { return (myself.Children()); }, id, false));
+    }
+
+    TEST(Core_ProcessInfo, Lookups)
+    {
+        Core::ProcessInfo myself;
+        const string executable(myself.Executable());
+        int channel[2];
+
+        ASSERT_EQ(::pipe(channel), 0);
+
+        EXPECT_TRUE(Contains(Core::ProcessInfo::Iterator(executable, true), myself.Id()));
+        EXPECT_TRUE(Contains(Core::ProcessInfo::Iterator(Core::File::FileNameExtended(executable), false), myself.Id()));
+
+        pid_t child = ::fork();
+
+        if (child == 0) {
+            char buffer;
+
+            ::close(channel[1]);
+            // Wait till the parent closes its end.
+            while (::read(channel[0], &buffer, 1) > 0) {
+            }
+            ::_exit(0);
+        }
+
+        ASSERT_GT(child, 0);
+        ::close(channel[0]);
+
+        const uint32_t id = static_cast<uint32_t>(child);
+
+        EXPECT_TRUE(Eventually([&myself]() { return (myself.Children()); }, id, true));
+        EXPECT_TRUE(Eventually([&executable]() { return (Core::ProcessInfo::Iterator(executable, true)); }, id, true));
+
+        ::close(channel[1]);
+        ::waitpid(child, nullptr, 0);
+
+        EXPECT_TRUE(Eventually([&myself]() { return (myself.Children()); }, id, false));
+        EXPECT_TRUE(Eventually([&executable]() { return (Core::ProcessInfo::Iterator(executable, true)); }, id, false));
+    }
+
+    TEST(Core_ProcessInfo, MemoryStatistics)
+    {
+        Core::ProcessInfo myself;
+        Core::ProcessInfo::Memory memory(myself.Statistics(true));
+
+        EXPECT_GT(memory.Allocated(), 0u);
+        EXPECT_GT(memory.Resident(), 0u);
+        EXPECT_GE(memory.Allocated(), memory.Resident());
+        EXPECT_GE(memory.Resident(), memory.Shared());
+
+        // Without asking for it, the proportional set size is not read.
+        EXPECT_EQ(myself.Statistics(false).Proportional(), 0u);
+    }
+
+} // Tests
+} // WPEFramework
@@ -6,6 +6,12 @@
 #include <com/com.h>
 #include <core/Portability.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 static string g_connectorName = _T("/tmp/wperpc01");
 
 namespace WPEFramework {
@@ -15,6 +21,7 @@ namespace Exchange {
         virtual uint32_t GetValue() = 0;
         virtual void Add(uint32_t value) = 0;
         virtual uint32_t GetPid() = 0;
+        virtual uint32_t Checksum(const uint16_t length, const uint8_t data[]) = 0;
     };
 }
 }
@@ -22,6 +29,44 @@ namespace Exchange {
 using namespace WPEFramework;
 using namespace std;
 
+// Set in the process that serves the adder: each Add waits till the expected number of them is in at the
+// same time, and only counts if that happened. Calls that are handled one after the other never meet.
+class Rendezvous {
+public:
+    Rendezvous()
+        : _lock()
+        , _arrived()
+        , _expected(0)
+        , _count(0)
+    {
+    }
+
+public:
+    void Expect(const uint32_t count)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _expected = count;
+        _count = 0;
+    }
+    bool Meet()
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+
+        _count++;
+        _arrived.notify_all();
+
+        return (_arrived.wait_for(lock, std::chrono::seconds(2), [this]() { return (_count >= _expected); }));
+    }
+
+private:
+    std::mutex _lock;
+    std::condition_variable _arrived;
+    uint32_t _expected;
+    uint32_t _count;
+};
+
+static Rendezvous g_rendezvous;
+
 class Adder : public Exchange::IAdder
 {
 public:
@@ -37,7 +82,9 @@ public:
 
     void Add(uint32_t value)
     {
-        m_value += value;
+        if (g_rendezvous.Meet() == true) {
+            m_value += value;
+        }
     }
 
     uint32_t GetPid()
@@ -45,12 +92,27 @@ public:
         return getpid();
     }
 
+    uint32_t Checksum(const uint16_t length, const uint8_t data[])
+    {
+        return Sum(length, data);
+    }
+
+    static uint32_t Sum(const uint16_t length, const uint8_t data[])
+    {
+        uint32_t result = 0;
+
+        for (uint16_t index = 0; index < length; index++) {
+            result = (result * 31) + data[index];
+        }
+        return result;
+    }
+
     BEGIN_INTERFACE_MAP(Adder)
         INTERFACE_ENTRY(Exchange::IAdder)
     END_INTERFACE_MAP
 
 private:
-    uint32_t m_value;
+    std::atomic<uint32_t> m_value;
 };
 
 // Proxystubs.
@@ -68,6 +130,7 @@ namespace WPEFramework {
     //  (0) virtual uint32_t GetValue() = 0
     //  (1) virtual void Add(uint32_t) = 0
     //  (2) virtual uint32_t GetPid() = 0
+    //  (3) virtual uint32_t Checksum(const uint16_t, const uint8_t[]) = 0
     //
 
     ProxyStub::MethodHandler AdderStubMethods[] = {
@@ -116,6 +179,27 @@ namespace WPEFramework {
             writer.Number<const uint32_t>(output);
         },
 
+        // virtual uint32_t Checksum(const uint16_t, const uint8_t[]) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint8_t* param1 = nullptr;
+            const uint16_t param0 = reader.LockBuffer<uint16_t>(param1);
+            reader.UnlockBuffer(param0);
+
+            // call implementation
+            IAdder* implementation = input.Implementation<IAdder>();
+            ASSERT((implementation != nullptr) && "Null IAdder implementation pointer");
+            const uint32_t output = implementation->Checksum(param0, param1);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
         nullptr
     }; // AdderStubMethods[]
 
@@ -130,6 +214,7 @@ namespace WPEFramework {
     //  (0) virtual uint32_t GetValue() = 0
     //  (1) virtual void Add(uint32_t) = 0
     //  (2) virtual uint32_t GetPid() = 0
+    //  (3) virtual uint32_t Checksum(const uint16_t, const uint8_t[]) = 0
     //
 
     class AdderProxy final : public ProxyStub::UnknownProxyType<IAdder> {
@@ -180,6 +265,25 @@ namespace WPEFramework {
 
             return output;
         }
+
+        uint32_t Checksum(const uint16_t param0, const uint8_t param1[]) override
+        {
+            IPCMessage newMessage(BaseClass::Message(3));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Buffer<uint16_t>(param0, param1);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
     }; // class AdderProxy
 
     // -----------------------------------------------------------------
@@ -216,6 +320,12 @@ public:
         Open(Core::infinite);
     }
 
+    ExternalAccess(const Core::NodeId & source, const Core::ProxyType<Core::IIPCServer> & handler)
+        : RPC::Communicator(source, _T(""), handler)
+    {
+        Open(Core::infinite);
+    }
+
     ~ExternalAccess()
     {
         Close(Core::infinite);
@@ -286,3 +396,201 @@ TEST(Core_RPC, adder)
    testAdmin.Sync("done testing");
    Core::Singleton::Dispose();
 }
+
+TEST(Core_RPC, PipelinedCalls)
+{
+   const uint8_t threadCount = 4;
+
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      // Handle the calls on a pool of threads, so the calls in flight are handled side by side.
+      Core::ProxyType<RPC::InvokeServerType<32, 8>> engine(Core::ProxyType<RPC::InvokeServerType<32, 8>>::Create(Core::Thread::DefaultStackSize()));
+      ExternalAccess communicator(remoteNode, Core::ProxyType<Core::IIPCServer>(engine));
+      engine->Announcements(communicator.Announcement());
+
+      g_rendezvous.Expect(threadCount);
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::InvokeServerType<4, 1>> engine(Core::ProxyType<RPC::InvokeServerType<4, 1>>::Create(Core::Thread::DefaultStackSize()));
+      Core::ProxyType<RPC::CommunicatorClient> client(
+           Core::ProxyType<RPC::CommunicatorClient>::Create(
+               remoteNode,
+               Core::ProxyType<Core::IIPCServer>(engine)
+           ));
+      engine->Announcements(client->Announcement());
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      // All calls go over the one connection. The adder only counts them if they are all in at the same
+      // time, so they must be in flight side by side.
+      std::vector<std::thread> threads;
+
+      for (uint8_t index = 0; index < threadCount; index++) {
+         threads.emplace_back([adder, index]() {
+            adder->Add(index + 1);
+         });
+      }
+      for (std::thread& thread : threads) {
+         thread.join();
+      }
+
+      EXPECT_EQ(adder->GetValue(), static_cast<uint32_t>((threadCount * (threadCount + 1)) / 2));
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
+
+TEST(Core_RPC, SharedBuffers)
+{
+   const uint32_t threshold = 1024;
+
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      RPC::Administrator::Instance().Threshold(threshold);
+
+      ExternalAccess communicator(remoteNode);
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      RPC::Administrator::Instance().Threshold(threshold);
+
+      Core::ProxyType<RPC::InvokeServerType<4, 1>> engine(Core::ProxyType<RPC::InvokeServerType<4, 1>>::Create(Core::Thread::DefaultStackSize()));
+      Core::ProxyType<RPC::CommunicatorClient> client(
+           Core::ProxyType<RPC::CommunicatorClient>::Create(
+               remoteNode,
+               Core::ProxyType<Core::IIPCServer>(engine)
+           ));
+      engine->Announcements(client->Announcement());
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      std::vector<uint8_t> data(60000);
+
+      for (uint32_t index = 0; index < data.size(); index++) {
+         data[index] = static_cast<uint8_t>(index * 7);
+      }
+
+      // Below the threshold the buffer goes inline, above it through the arena. Far more than fits in
+      // the arena at once, so the space released by the other side must be reused.
+      EXPECT_EQ(adder->Checksum(100, data.data()), Adder::Sum(100, data.data()));
+      for (uint32_t round = 0; round < 100; round++) {
+         const uint16_t length = static_cast<uint16_t>(data.size() - round);
+         EXPECT_EQ(adder->Checksum(length, data.data()), Adder::Sum(length, data.data()));
+      }
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+
+      RPC::Administrator::Instance().Threshold(0);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
+
+TEST(Core_RPC, SteadyStateAllocations)
+{
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      ExternalAccess communicator(remoteNode);
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::InvokeServerType<4, 1>> engine(Core::ProxyType<RPC::InvokeServerType<4, 1>>::Create(Core::Thread::DefaultStackSize()));
+      Core::ProxyType<RPC::CommunicatorClient> client(
+           Core::ProxyType<RPC::CommunicatorClient>::Create(
+               remoteNode,
+               Core::ProxyType<Core::IIPCServer>(engine)
+           ));
+      engine->Announcements(client->Announcement());
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      // Larger than a frame block, so the frame has to grow once.
+      std::vector<uint8_t> data(2000, 0x55);
+      std::vector<std::thread> threads;
+
+      // Fill the pools with more messages than one caller keeps in flight.
+      for (uint8_t index = 0; index < 4; index++) {
+         threads.emplace_back([adder, &data]() {
+            for (uint32_t call = 0; call < 25; call++) {
+               adder->Checksum(static_cast<uint16_t>(data.size()), data.data());
+            }
+         });
+      }
+      for (std::thread& thread : threads) {
+         thread.join();
+      }
+
+      // Once the pools are filled, calls do not need new messages or frame memory anymore.
+      const RPC::Administrator::Metadata before(RPC::Administrator::Instance().Snapshot());
+
+      for (uint32_t index = 0; index < 500; index++) {
+         adder->Add(1);
+         EXPECT_EQ(adder->Checksum(static_cast<uint16_t>(data.size()), data.data()), Adder::Sum(static_cast<uint16_t>(data.size()), data.data()));
+      }
+
+      const RPC::Administrator::Metadata after(RPC::Administrator::Instance().Snapshot());
+
+      EXPECT_EQ(adder->GetValue(), static_cast<uint32_t>(500));
+      EXPECT_EQ(before.Messages, after.Messages);
+      EXPECT_EQ(before.Jobs, after.Jobs);
+      EXPECT_EQ(before.Frames, after.Frames);
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
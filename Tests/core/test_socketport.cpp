@@ -0,0 +1,369 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class GatherPort : public Core::SocketPort {
+    private:
+        GatherPort() = delete;
+        GatherPort(const GatherPort&) = delete;
+        GatherPort& operator=(const GatherPort&) = delete;
+
+    public:
+        GatherPort(const SOCKET connector, const std::vector<std::vector<uint8_t>>& slices)
+            : Core::SocketPort(Core::SocketPort::STREAM, connector, Core::NodeId(_T("/tmp/testgatherport")), 1024, 1024)
+            , _slices(slices)
+            , _handed(false)
+            , _gathered(0)
+        {
+        }
+        virtual ~GatherPort()
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        uint32_t GatheredCount() const
+        {
+            return (_gathered);
+        }
+
+    private:
+        virtual uint16_t Gather(Slice slices[], const uint16_t maxSlices) override
+        {
+            uint16_t result = 0;
+
+            if (_handed == false) {
+                _handed = true;
+
+                for (; ((result < maxSlices) && (result < _slices.size())); result++) {
+                    slices[result].Buffer = _slices[result].data();
+                    slices[result].Size = static_cast<uint32_t>(_slices[result].size());
+                }
+            }
+
+            return (result);
+        }
+        virtual void Gathered() override
+        {
+            _gathered++;
+        }
+        virtual uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */) override
+        {
+            return (0);
+        }
+        virtual uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t receivedSize) override
+        {
+            return (receivedSize);
+        }
+        virtual void StateChange() override
+        {
+        }
+
+    private:
+        const std::vector<std::vector<uint8_t>>& _slices;
+        bool _handed;
+        std::atomic<uint32_t> _gathered;
+    };
+
+    TEST(Core_SocketPort, GatherPartialWrites)
+    {
+        int channel[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, channel), 0);
+
+        // A small socket buffer, so the slices only go out a bit at a time, and a partial write
+        // ends in the middle of a slice (or on the empty one).
+        int size = 4096;
+        ::setsockopt(channel[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+
+        std::vector<std::vector<uint8_t>> slices = { std::vector<uint8_t>(100003), std::vector<uint8_t>(1), std::vector<uint8_t>(), std::vector<uint8_t>(50000) };
+        std::vector<uint8_t> expected;
+
+        for (std::vector<uint8_t>& slice : slices) {
+            for (uint32_t index = 0; index < slice.size(); index++) {
+                slice[index] = static_cast<uint8_t>(expected.size() * 13);
+                expected.push_back(slice[index]);
+            }
+        }
+
+        {
+            GatherPort port(channel[0], slices);
+
+            EXPECT_EQ(port.Open(0), Core::ERROR_NONE);
+
+            port.Trigger();
+
+            std::vector<uint8_t> received;
+            uint8_t buffer[3000];
+
+            while (received.size() < expected.size()) {
+                ssize_t length = ::read(channel[1], buffer, sizeof(buffer));
+
+                ASSERT_GT(length, 0);
+                received.insert(received.end(), buffer, buffer + length);
+            }
+
+            EXPECT_EQ(received.size(), expected.size());
+            EXPECT_TRUE(received == expected);
+
+            uint8_t waiting = 100;
+            while ((port.GatheredCount() == 0) && (--waiting != 0)) {
+                SleepMs(10);
+            }
+            EXPECT_EQ(port.GatheredCount(), 1u);
+        }
+
+        ::close(channel[1]);
+    }
+
+    TEST(Core_SocketPort, GatherReleasedOnClose)
+    {
+        int channel[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, channel), 0);
+
+        int size = 4096;
+        ::setsockopt(channel[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+
+        std::vector<std::vector<uint8_t>> slices = { std::vector<uint8_t>(1024 * 1024, 0x55) };
+
+        {
+            GatherPort port(channel[0], slices);
+
+            EXPECT_EQ(port.Open(0), Core::ERROR_NONE);
+
+            port.Trigger();
+
+            // Nobody reads, so the slices can not be sent completely. Closing hands them back.
+            SleepMs(50);
+            EXPECT_EQ(port.GatheredCount(), 0u);
+
+            port.Close(100);
+
+            EXPECT_EQ(port.GatheredCount(), 1u);
+        }
+
+        ::close(channel[1]);
+    }
+
+    class BatchPort : public Core::SocketPort {
+    private:
+        BatchPort() = delete;
+        BatchPort(const BatchPort&) = delete;
+        BatchPort& operator=(const BatchPort&) = delete;
+
+    public:
+        // The receive buffer is the size of the socket buffer as well, keep it big enough to hold all
+        // datagrams that are send at once.
+        BatchPort(const Core::NodeId& local, const uint16_t chunk)
+            : Core::SocketPort(Core::SocketPort::DATAGRAM, local, Core::NodeId(), 1024, 16384)
+            , _chunk(chunk)
+            , _adminLock()
+            , _received()
+            , _calls(0)
+            , _senders()
+        {
+        }
+        virtual ~BatchPort()
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        std::vector<uint8_t> Received() const
+        {
+            Core::SafeSyncType<Core::CriticalSection> scopedLock(_adminLock);
+            return (_received);
+        }
+        uint32_t Calls() const
+        {
+            Core::SafeSyncType<Core::CriticalSection> scopedLock(_adminLock);
+            return (_calls);
+        }
+        std::vector<uint16_t> Senders() const
+        {
+            Core::SafeSyncType<Core::CriticalSection> scopedLock(_adminLock);
+            return (_senders);
+        }
+
+    private:
+        virtual uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */) override
+        {
+            return (0);
+        }
+        // Consumes at most a chunk per call, so every datagram is offered a couple of times.
+        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            uint16_t result = std::min(_chunk, receivedSize);
+
+            Core::SafeSyncType<Core::CriticalSection> scopedLock(_adminLock);
+            _received.insert(_received.end(), dataFrame, dataFrame + result);
+            _senders.push_back(ReceivedNode().PortNumber());
+            _calls++;
+
+            return (result);
+        }
+        virtual void StateChange() override
+        {
+        }
+
+    private:
+        const uint16_t _chunk;
+        mutable Core::CriticalSection _adminLock;
+        std::vector<uint8_t> _received;
+        uint32_t _calls;
+        std::vector<uint16_t> _senders;
+    };
+
+    TEST(Core_SocketPort, BatchPartialReads)
+    {
+        const Core::NodeId local(_T("127.0.0.1"), 12361);
+        BatchPort port(local, 7);
+
+        ASSERT_TRUE(port.Batch(4));
+        ASSERT_EQ(port.Open(0), Core::ERROR_NONE);
+
+        SOCKET sender = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_NE(sender, INVALID_SOCKET);
+
+        const Core::NodeId from(_T("127.0.0.1"), 12362);
+        ASSERT_EQ(::bind(sender, reinterpret_cast<const struct sockaddr*>(&(static_cast<const Core::NodeId::SocketInfo&>(from))), from.Size()), 0);
+
+        // More datagrams than slots, with sizes that are no multiple of the chunk the port consumes.
+        const uint16_t sizes[] = { 20, 1, 7, 100, 33, 0, 64 };
+        std::vector<uint8_t> expected;
+        uint32_t calls = 0;
+
+        for (const uint16_t size : sizes) {
+            uint8_t buffer[128];
+
+            for (uint16_t index = 0; index < size; index++) {
+                buffer[index] = static_cast<uint8_t>(expected.size());
+                expected.push_back(buffer[index]);
+            }
+            calls += (size + 6) / 7;
+
+            ASSERT_EQ(::sendto(sender, buffer, size, 0, reinterpret_cast<const struct sockaddr*>(&(static_cast<const Core::NodeId::SocketInfo&>(local))), local.Size()), size);
+        }
+
+        uint8_t waiting = 200;
+        while ((port.Received().size() < expected.size()) && (--waiting != 0)) {
+            SleepMs(10);
+        }
+
+        EXPECT_EQ(port.Received().size(), expected.size());
+        EXPECT_TRUE(port.Received() == expected);
+        EXPECT_EQ(port.Calls(), calls);
+
+        for (const uint16_t senderPort : port.Senders()) {
+            EXPECT_EQ(senderPort, 12362);
+        }
+
+        ::close(sender);
+    }
+
+    class NetlinkPort : public Core::SocketPort {
+    private:
+        NetlinkPort(const NetlinkPort&) = delete;
+        NetlinkPort& operator=(const NetlinkPort&) = delete;
+
+    public:
+        NetlinkPort()
+            : Core::SocketPort(Core::SocketPort::DATAGRAM, Core::NodeId(NETLINK_ROUTE, 0, 0), Core::NodeId(), 1024, 8192)
+            , _requested(false)
+            , _links(0)
+            , _done(false, true)
+        {
+        }
+        virtual ~NetlinkPort()
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        uint32_t Links() const
+        {
+            return (_links);
+        }
+        bool Done(const uint32_t waitTime)
+        {
+            return (_done.Lock(waitTime) == Core::ERROR_NONE);
+        }
+
+    private:
+        // A single dump request of all links.
+        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            uint16_t result = 0;
+
+            if (_requested == false) {
+                struct Request {
+                    struct nlmsghdr header;
+                    struct ifinfomsg message;
+                }* request = reinterpret_cast<Request*>(dataFrame);
+
+                ASSERT(maxSendSize >= sizeof(Request));
+
+                ::memset(request, 0, sizeof(Request));
+                request->header.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+                request->header.nlmsg_type = RTM_GETLINK;
+                request->header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+                request->header.nlmsg_seq = 1;
+                request->message.ifi_family = AF_UNSPEC;
+
+                _requested = true;
+                result = static_cast<uint16_t>(request->header.nlmsg_len);
+            }
+
+            return (result);
+        }
+        // Consumes one netlink message per call, so a datagram carrying a couple of them is offered
+        // a couple of times.
+        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            const struct nlmsghdr* header = reinterpret_cast<const struct nlmsghdr*>(dataFrame);
+            uint16_t result = receivedSize;
+
+            if (NLMSG_OK(header, receivedSize)) {
+                result = std::min(static_cast<uint16_t>(NLMSG_ALIGN(header->nlmsg_len)), receivedSize);
+
+                if (header->nlmsg_type == RTM_NEWLINK) {
+                    _links++;
+                } else if ((header->nlmsg_type == NLMSG_DONE) || (header->nlmsg_type == NLMSG_ERROR)) {
+                    _done.SetEvent();
+                }
+            }
+
+            return (result);
+        }
+        virtual void StateChange() override
+        {
+        }
+
+    private:
+        bool _requested;
+        std::atomic<uint32_t> _links;
+        Core::Event _done;
+    };
+
+    TEST(Core_SocketPort, BatchNetlink)
+    {
+        NetlinkPort port;
+
+        ASSERT_TRUE(port.Batch(4));
+        ASSERT_EQ(port.Open(0), Core::ERROR_NONE);
+
+        port.Trigger();
+
+        // Every host has at least the loopback link.
+        EXPECT_TRUE(port.Done(2000));
+        EXPECT_GE(port.Links(), 1u);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static Core::CriticalSection g_timerLock;
+    static std::list<uint64_t> g_timerFired;
+
+    class TimeHandler {
+    public:
+        TimeHandler()
+            : _id(0)
+        {
+        }
+        TimeHandler(const uint32_t id)
+            : _id(id)
+        {
+        }
+        TimeHandler(const TimeHandler& copy)
+            : _id(copy._id)
+        {
+        }
+        TimeHandler& operator=(const TimeHandler& rhs)
+        {
+            _id = rhs._id;
+            return (*this);
+        }
+        bool operator==(const TimeHandler& rhs) const
+        {
+            return (_id == rhs._id);
+        }
+        bool operator!=(const TimeHandler& rhs) const
+        {
+            return (!operator==(rhs));
+        }
+
+    public:
+        uint64_t Timed(const uint64_t scheduledTime)
+        {
+            g_timerLock.Lock();
+            g_timerFired.push_back(scheduledTime);
+            g_timerLock.Unlock();
+
+            return (0);
+        }
+
+    private:
+        uint32_t _id;
+    };
+
+    TEST(Core_Timer, Order)
+    {
+        // Leave some time to schedule and revoke before the first one is due.
+        const uint64_t now = Core::Time::Now().Ticks() + (50 * Core::Time::TicksPerMillisecond);
+
+        g_timerFired.clear();
+
+        {
+            Core::TimerType<TimeHandler> timer(Core::Thread::DefaultStackSize(), _T("TestTimer"));
+
+            // Spread over the first two levels of the wheel, and revoke every 4th timer.
+            for (uint32_t index = 0; index < 200; index++) {
+                timer.Schedule(now + (((index * 7919) % 150) * Core::Time::TicksPerMillisecond) + (index % 1000), TimeHandler(index));
+            }
+            for (uint32_t index = 0; index < 200; index += 4) {
+                EXPECT_TRUE(timer.Revoke(TimeHandler(index)));
+            }
+            EXPECT_FALSE(timer.Revoke(TimeHandler(0)));
+            EXPECT_EQ(timer.Pending(), 150u);
+
+            uint32_t waiting = 100;
+            while ((timer.Pending() != 0) && (waiting-- != 0)) {
+                SleepMs(10);
+            }
+            EXPECT_EQ(timer.Pending(), 0u);
+        }
+
+        ASSERT_EQ(g_timerFired.size(), 150u);
+
+        // Timers within the same millisecond are fired together, so they are ordered per millisecond.
+        uint64_t previous = 0;
+        for (const uint64_t fired : g_timerFired) {
+            EXPECT_LE(previous / Core::Time::TicksPerMillisecond, fired / Core::Time::TicksPerMillisecond);
+            previous = fired;
+        }
+    }
+
+    TEST(Core_Timer, AllLevels)
+    {
+        const uint64_t now = Core::Time::Now().Ticks();
+
+        g_timerFired.clear();
+
+        Core::TimerType<TimeHandler> timer(Core::Thread::DefaultStackSize(), _T("TestTimer"));
+
+        // One timer that expires during the test, the others land on every level of the wheel
+        // and in the overflow list (more than 4.6 hours out).
+        timer.Schedule(now + (20 * Core::Time::TicksPerMillisecond), TimeHandler(0));
+
+        const uint64_t spread[] = { 100, 10 * 1000, 10 * 60 * 1000, 3 * 60 * 60 * 1000, 6 * 60 * 60 * 1000 };
+        for (uint32_t index = 1; index <= 1000; index++) {
+            timer.Schedule(now + ((spread[index % 5] + index) * Core::Time::TicksPerMillisecond) + (60 * 1000 * Core::Time::TicksPerMillisecond), TimeHandler(index));
+        }
+        EXPECT_EQ(timer.Pending(), 1001u);
+
+        for (uint32_t index = 10; index <= 1000; index += 10) {
+            EXPECT_TRUE(timer.Revoke(TimeHandler(index)));
+            EXPECT_FALSE(timer.Revoke(TimeHandler(index)));
+        }
+        EXPECT_EQ(timer.Pending(), 901u);
+
+        uint32_t waiting = 100;
+        while ((timer.Pending() != 900) && (waiting-- != 0)) {
+            SleepMs(10);
+        }
+        EXPECT_EQ(timer.Pending(), 900u);
+
+        g_timerLock.Lock();
+        EXPECT_EQ(g_timerFired.size(), 1u);
+        g_timerLock.Unlock();
+    }
+
+} // Tests
+} // WPEFramework